@@ -20,6 +20,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 // inform interface that we are building library here
 #define FPP_BUILD_SHARED
 
+#include <algorithm>
+
 #include "fact.h"
 #include "Kernel.h"
 #include "Actor.h"
@@ -72,6 +74,15 @@ public:		// interface
 	}
 }; // CActor
 
+/// flat copy of the concept taxonomy at a C level
+struct CTaxonomy
+{
+		/// names of all the vertices
+	std::vector<const char*> Names;
+		/// vertices and their parents
+	std::vector<unsigned int> Structure;
+}; // CTaxonomy
+
 // type declarations
 
 #define DECLARE_STRUCT(name,type)	\
@@ -106,6 +117,8 @@ DECLARE_STRUCT(fact_data_value_expression,ReasoningKernel::TDataValueExpr);
 DECLARE_STRUCT(fact_facet_expression,ReasoningKernel::TFacetExpr);
 // actor to traverse taxonomy
 DECLARE_STRUCT(fact_actor,CActor);
+// flat copy of the concept taxonomy
+DECLARE_STRUCT(fact_taxonomy,CTaxonomy);
 
 const char *fact_get_version ()
 {
@@ -358,6 +371,52 @@ void fact_retract (fact_reasoning_kernel *k, fact_axiom *axiom)
 	k->p->retract(axiom->p);
 }
 
+void fact_begin_batch (fact_reasoning_kernel *k)
+{
+	k->p->beginBatch();
+}
+void fact_commit_batch (fact_reasoning_kernel *k)
+{
+	k->p->commitBatch();
+}
+void fact_get_batch_report (fact_reasoning_kernel *k,
+		unsigned int *n_added, unsigned int *n_retracted,
+		unsigned int *n_reloads, double *time)
+{
+	const ReasoningKernel::BatchReport& report = k->p->getBatchReport();
+	if ( n_added != nullptr )
+		*n_added = static_cast<unsigned int>(report.nAdded);
+	if ( n_retracted != nullptr )
+		*n_retracted = static_cast<unsigned int>(report.nRetracted);
+	if ( n_reloads != nullptr )
+		*n_reloads = report.nReloadsSaved;
+	if ( time != nullptr )
+		*time = report.time;
+}
+
+unsigned int fact_load_axiom_stream (fact_reasoning_kernel *k,
+		const int *codes, unsigned int n,
+		const char *const *names, unsigned int n_names,
+		fact_axiom ***axioms)
+{
+	std::vector<const char*> Names ( names, names + n_names );
+	AxiomVec Axioms;
+	k->p->loadAxiomStream ( codes, n, Names, Axioms );
+	if ( axioms != nullptr )
+	{
+		*axioms = new fact_axiom*[Axioms.size()];
+		for ( size_t i = 0; i < Axioms.size(); ++i )
+			(*axioms)[i] = new fact_axiom_st(Axioms[i]);
+	}
+	return static_cast<unsigned int>(Axioms.size());
+}
+void fact_axioms_free (fact_axiom **axioms, unsigned int n)
+{
+	for ( unsigned int i = 0; i < n; ++i )
+		delete axioms[i];
+	delete [] axioms;
+}
+
 int fact_is_kb_consistent (fact_reasoning_kernel *k)
 {
 	return k->p->isKBConsistent();
@@ -459,6 +518,33 @@ int fact_is_equivalent (fact_reasoning_kernel *k, fact_concept_expression *c,
 {
 	return k->p->isEquivalent(c->p,d->p);
 }
+void fact_is_satisfiable_batch (fact_reasoning_kernel *k,
+		fact_concept_expression **c, unsigned int n, unsigned char *result)
+{
+	ReasoningKernel::ConceptVec C;
+	C.reserve(n);
+	for ( unsigned int i = 0; i < n; ++i )
+		C.push_back(c[i]->p);
+	ReasoningKernel::QueryResultBits Result;
+	k->p->isSatisfiable ( C, Result );
+	std::copy ( Result.begin(), Result.end(), result );
+}
+void fact_is_subsumed_by_batch (fact_reasoning_kernel *k,
+		fact_concept_expression **c, fact_concept_expression **d,
+		unsigned int n, unsigned char *result)
+{
+	ReasoningKernel::ConceptVec C, D;
+	C.reserve(n);
+	D.reserve(n);
+	for ( unsigned int i = 0; i < n; ++i )
+	{
+		C.push_back(c[i]->p);
+		D.push_back(d[i]->p);
+	}
+	ReasoningKernel::QueryResultBits Result;
+	k->p->isSubsumedBy ( C, D, Result );
+	std::copy ( Result.begin(), Result.end(), result );
+}
 
 void fact_get_sup_concepts (fact_reasoning_kernel *k, fact_concept_expression *c,
 		int direct, fact_actor **actor)
@@ -554,6 +640,23 @@ int fact_is_related (fact_reasoning_kernel *k,
 {
 	return k->p->isRelated(i->p,r->p,j->p);
 }
+void fact_get_data_value_instances (fact_reasoning_kernel *k,
+		fact_d_role_expression *r,
+		fact_data_value_expression *min, int min_excl,
+		fact_data_value_expression *max, int max_excl,
+		fact_actor **actor)
+{
+	ReasoningKernel::IndividualSet Result;
+	k->p->getDataValueInstances ( r->p, min ? min->p : nullptr, min_excl, max ? max->p : nullptr, max_excl, Result );
+	// same-as individuals share the vertex; report it once
+	std::set<const TaxonomyVertex*> Vertices;
+	for ( const TNamedEntry* ind: Result )
+	{
+		const TaxonomyVertex* v = resolveSynonym(static_cast<const TIndividual*>(ind))->getTaxVertex();
+		if ( v != nullptr && Vertices.insert(v).second )
+			(*actor)->p->apply(*v);
+	}
+}
 fact_actor* fact_concept_actor_new()
 {
 	fact_actor* ret = new fact_actor(new CActor());
@@ -599,6 +702,37 @@ const char** fact_get_elements_1d ( fact_actor* actor )
 	return actor->p->getElements1D();
 }
 
+/// export the whole classified concept taxonomy at once
+fact_taxonomy* fact_get_concept_taxonomy ( fact_reasoning_kernel *k )
+{
+	ReasoningKernel::NamesVector Names;
+	std::vector<unsigned int> Structure;
+	k->p->getConceptTaxonomy ( Names, Structure );
+	CTaxonomy* tax = new CTaxonomy();
+	tax->Structure.swap(Structure);
+	tax->Names.reserve(Names.size());
+	for ( const TNamedEntry* name: Names )
+		tax->Names.push_back(name->getName());
+	return new fact_taxonomy(tax);
+}
+void fact_taxonomy_free ( fact_taxonomy* tax )
+{
+	delete tax->p;
+	delete tax;
+}
+/// get names of all the vertices
+const char* const* fact_taxonomy_names ( fact_taxonomy* tax, unsigned int* n )
+{
+	*n = static_cast<unsigned int>(tax->p->Names.size());
+	return tax->p->Names.data();
+}
+/// get vertices and their parents
+const unsigned int* fact_taxonomy_structure ( fact_taxonomy* tax, unsigned int* n )
+{
+	*n = static_cast<unsigned int>(tax->p->Structure.size());
+	return tax->p->Structure.data();
+}
+
 /// opens new argument list
 void fact_new_arg_list ( fact_reasoning_kernel *k )
 {
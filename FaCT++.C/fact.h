@@ -31,6 +31,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #	define FPP_EXPORT
 #endif
 
+/* codes of the axiom stream for the bulk loading (see fact_load_axiom_stream) */
+#include "AxiomStreamCodes.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,6 +71,8 @@ DECLARE_STRUCT(fact_data_value_expression);
 DECLARE_STRUCT(fact_facet_expression);
 /* actor to traverse taxonomy */
 DECLARE_STRUCT(fact_actor);
+/* flat copy of the concept taxonomy */
+DECLARE_STRUCT(fact_taxonomy);
 
 #undef DECLARE_STRUCT
 
@@ -181,6 +185,25 @@ FPP_EXPORT fact_axiom *fact_set_fairness_constraint (fact_reasoning_kernel *);
 
 FPP_EXPORT void fact_retract (fact_reasoning_kernel *, fact_axiom *axiom);
 
+FPP_EXPORT void fact_begin_batch (fact_reasoning_kernel *);
+FPP_EXPORT void fact_commit_batch (fact_reasoning_kernel *);
+/* report about the last committed batch: numbers of added and retracted axioms, number of KB reloads saved
+ * (changed ontology versions queried during the batch) and the time of the re-reasoning pass in seconds;
+ * any pointer can be NULL */
+FPP_EXPORT void fact_get_batch_report (fact_reasoning_kernel *,
+		unsigned int *n_added, unsigned int *n_retracted,
+		unsigned int *n_reloads, double *time);
+
+/* add all the axioms from the stream of N CODES (see enum AxiomStreamCode) that refers to the N_NAMES NAMES;
+ * return the number of added axioms. If AXIOMS is not NULL then *AXIOMS is set to the array of the added
+ * axioms (e.g., for fact_retract()) that should be released by fact_axioms_free() */
+FPP_EXPORT unsigned int fact_load_axiom_stream (fact_reasoning_kernel *,
+		const int *codes, unsigned int n,
+		const char *const *names, unsigned int n_names,
+		fact_axiom ***axioms);
+/* release N axioms returned by fact_load_axiom_stream() */
+FPP_EXPORT void fact_axioms_free (fact_axiom **axioms, unsigned int n);
+
 FPP_EXPORT int fact_is_kb_consistent (fact_reasoning_kernel *);
 FPP_EXPORT void fact_preprocess_kb (fact_reasoning_kernel *);
 FPP_EXPORT void fact_classify_kb (fact_reasoning_kernel *);
@@ -216,6 +239,12 @@ FPP_EXPORT int fact_is_disjoint (fact_reasoning_kernel *, fact_concept_expressio
 		fact_concept_expression *d);
 FPP_EXPORT int fact_is_equivalent (fact_reasoning_kernel *, fact_concept_expression *c,
 		fact_concept_expression *d);
+/* batch queries over N concepts (pairs); the answer to the i-th query is the bit (i%8) of result[i/8] */
+FPP_EXPORT void fact_is_satisfiable_batch (fact_reasoning_kernel *,
+		fact_concept_expression **c, unsigned int n, unsigned char *result);
+FPP_EXPORT void fact_is_subsumed_by_batch (fact_reasoning_kernel *,
+		fact_concept_expression **c, fact_concept_expression **d,
+		unsigned int n, unsigned char *result);
 
 FPP_EXPORT void fact_get_sup_concepts (fact_reasoning_kernel *, fact_concept_expression *c,
 		int direct, fact_actor **actor);
@@ -269,6 +298,12 @@ FPP_EXPORT int fact_is_related (fact_reasoning_kernel *,
 		 fact_individual_expression *i,
 		 fact_o_role_expression *r,
 		 fact_individual_expression *j);
+/* individuals with a told R-value between MIN and MAX (NULL for no bound) */
+FPP_EXPORT void fact_get_data_value_instances (fact_reasoning_kernel *,
+		fact_d_role_expression *r,
+		fact_data_value_expression *min, int min_excl,
+		fact_data_value_expression *max, int max_excl,
+		fact_actor **actor);
 
 FPP_EXPORT fact_actor* fact_concept_actor_new();
 FPP_EXPORT fact_actor* fact_individual_actor_new();
@@ -282,6 +317,15 @@ FPP_EXPORT const char*** fact_get_elements_2d ( fact_actor* );
 /* get NULL-terminated 1D array of all required elements of the taxonomy */
 FPP_EXPORT const char** fact_get_elements_1d ( fact_actor* );
 
+/* export the whole classified concept taxonomy at once. Vertices are numbered from 0 (BOTTOM); 1 is TOP */
+FPP_EXPORT fact_taxonomy* fact_get_concept_taxonomy ( fact_reasoning_kernel *k );
+FPP_EXPORT void fact_taxonomy_free ( fact_taxonomy* );
+/* get N names: first the names of vertex 0, then the names of vertex 1, etc. */
+FPP_EXPORT const char* const* fact_taxonomy_names ( fact_taxonomy*, unsigned int* n );
+/* get N numbers: the number of vertices followed by the number of names,
+   the number of direct parents and the parent numbers of every vertex */
+FPP_EXPORT const unsigned int* fact_taxonomy_structure ( fact_taxonomy*, unsigned int* n );
+
 /* opens new argument list */
 FPP_EXPORT void fact_new_arg_list ( fact_reasoning_kernel *k );
 /* add argument _a_rG to the current argument list */
@@ -58,6 +58,17 @@ int main ( void )
 	fact_implies_concepts ( k, some, d );
 	fact_instance_of ( k, i, c );
 
+	// load E [= C, J:E in one call
+	puts("Loading axiom stream");
+	const char* streamNames[] = { "E", "C", "J" };
+	const int stream[] = {
+		ascConceptInclusion, ascConceptName, 0, ascConceptName, 1,
+		ascInstanceOf, ascIndividualName, 2, ascConceptName, 0 };
+	fact_axiom** loaded;
+	unsigned int nLoaded = fact_load_axiom_stream ( k, stream, sizeof(stream)/sizeof(stream[0]), streamNames, 3, &loaded );
+	printf("%u axioms loaded\n", nLoaded);
+	fact_axioms_free(loaded,nLoaded);
+
 	// classify KB is not necessary: it's done automatically depending on a query
 	puts("Classifying ontology");
 	fact_classify_kb(k);
@@ -91,9 +102,68 @@ int main ( void )
 	print2Darray(fact_get_elements_2d(actor));
 	fact_actor_free(actor);
 
+	// export the whole concept taxonomy at once
+	puts("Concept taxonomy:");
+	fact_taxonomy* tax = fact_get_concept_taxonomy(k);
+	unsigned int nNames, nStruct;
+	const char* const* names = fact_taxonomy_names(tax,&nNames);
+	const unsigned int* taxStruct = fact_taxonomy_structure(tax,&nStruct);
+	unsigned int v, j, pos = 1, name = 0;
+	for ( v = 0; v < taxStruct[0]; ++v )
+	{
+		unsigned int vNames = taxStruct[pos++], vParents = taxStruct[pos++];
+		printf("%u: [", v);
+		for ( j = 0; j < vNames; ++j )
+			printf("%s ", names[name++]);
+		printf("] parents:");
+		for ( j = 0; j < vParents; ++j )
+			printf(" %u", taxStruct[pos++]);
+		printf("\n");
+	}
+	fact_taxonomy_free(tax);
+
+	// A has age 30, B has no age; an instance test for B should not make it 50
+	puts("Individuals with age 50:");
+	fact_individual_expression* a = fact_individual(k,"A");
+	fact_individual_expression* b = fact_individual(k,"B");
+	fact_d_role_expression* age = fact_data_role(k,"age");
+	fact_data_type_expression* intType = fact_get_int_data_type(k);
+	fact_value_of ( k, a, age, fact_data_value(k,"30",intType) );
+	fact_instance_of ( k, b, fact_top(k) );
+	fact_data_value_expression* v50 = fact_data_value(k,"50",intType);
+	fact_is_instance ( k, b, fact_not(k,fact_d_value(k,age,v50)) );
+	i_actor = fact_individual_actor_new();
+	fact_get_data_value_instances ( k, age, v50, 0, v50, 0, &i_actor );
+	print2Darray(fact_get_elements_2d(i_actor));
+	fact_actor_free(i_actor);
+	puts("Individuals with any age:");
+	i_actor = fact_individual_actor_new();
+	fact_get_data_value_instances ( k, age, NULL, 0, NULL, 0, &i_actor );
+	print2Darray(fact_get_elements_2d(i_actor));
+	fact_actor_free(i_actor);
+
 	// we done so let's free memory
 	puts("Destroying reasoning kernel");
 	fact_reasoning_kernel_free(k);
+
+	// the first batch of a new KB: queries inside it would throw, as nothing was committed yet
+	puts("Committing the first batch of a new KB");
+	k = fact_reasoning_kernel_new();
+	fact_new_kb(k);
+	fact_begin_batch(k);
+	fact_concept_expression* ba = fact_concept(k,"A");
+	fact_concept_expression* bb = fact_concept(k,"B");
+	fact_implies_concepts ( k, ba, bb );
+	fact_commit_batch(k);
+	unsigned int nAdded, nRetracted;
+	fact_get_batch_report ( k, &nAdded, &nRetracted, NULL, NULL );
+	printf("%u added, %u retracted\n", nAdded, nRetracted);
+	puts("Is A subsumed by B?");
+	if ( fact_is_subsumed_by(k,ba,bb) )
+		puts("Yes!\n");
+	else
+		puts("No...\n");
+	fact_reasoning_kernel_free(k);
 	puts("All done");
 	return 0;
 }
@@ -93,6 +93,8 @@ JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_initKe
 	Kernel->setDumpOntology(Kernel->getOptions()->getBool("dumpOntology"));
 	// init incremental reasoning
 	Kernel->setUseIncrementalReasoning(Kernel->getOptions()->getBool("useIncrementalReasoning"));
+	// init incremental ABox updates
+	Kernel->setUseIncrementalABox(Kernel->getOptions()->getBool("useIncrementalABox"));
 
 	// setup JNI cache
 	TJNICache* J = new TJNICache(env);
@@ -140,6 +140,30 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 	return J->buildArray ( J->K->getNonLocal(moduleMethodByInt(moduleMethod),moduleTypeByInt(moduleType)), J->AxiomPointer );
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getModuleCacheHitNumber
+ * Signature: (I)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getModuleCacheHitNumber
+  (JNIEnv * env, jobject obj, jint moduleMethod)
+{
+	TRACE_JNI("getModuleCacheHitNumber");
+	return (jlong)getK(env,obj)->getModuleCacheHitNumber(moduleMethodByInt(moduleMethod));
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getSavedLocCheckNumber
+ * Signature: (I)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getSavedLocCheckNumber
+  (JNIEnv * env, jobject obj, jint moduleMethod)
+{
+	TRACE_JNI("getSavedLocCheckNumber");
+	return (jlong)getK(env,obj)->getSavedLocCheckNumber(moduleMethodByInt(moduleMethod));
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 
 // this file contains implementation of DL query-related methods of FaCT++ JNI interface
 
+#include <string>
+
 #include "uk_ac_manchester_cs_factplusplus_FaCTPlusPlus.h"
 #include "Kernel.h"
 #include "tJNICache.h"
@@ -92,6 +94,80 @@ JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_realis
 	PROCESS_QUERY ( getK(env,obj)->realiseKB() );
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    beginBatch
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_beginBatch
+  (JNIEnv * env, jobject obj)
+{
+	TRACE_JNI("beginBatch");
+	PROCESS_QUERY ( getK(env,obj)->beginBatch() );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    commitBatch
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_commitBatch
+  (JNIEnv * env, jobject obj)
+{
+	MemoryStatistics MS("Batch update");
+	TRACE_JNI("commitBatch");
+	PROCESS_QUERY ( getK(env,obj)->commitBatch() );
+	if ( env->ExceptionCheck() )
+		return nullptr;
+	// report: added and retracted axioms, saved KB reloads, time in milliseconds
+	const ReasoningKernel::BatchReport& report = getK(env,obj)->getBatchReport();
+	jlong values[] = { (jlong)report.nAdded, (jlong)report.nRetracted, (jlong)report.nReloadsSaved, (jlong)(report.time*1000) };
+	jlongArray ret = env->NewLongArray(4);
+	env->SetLongArrayRegion ( ret, 0, 4, values );
+	return ret;
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    loadAxiomStream
+ * Signature: ([I[Ljava/lang/String;)[Luk/ac/manchester/cs/factplusplus/AxiomPointer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_loadAxiomStream
+  (JNIEnv * env, jobject obj, jintArray codes, jobjectArray names)
+{
+	MemoryStatistics MS("Bulk loading");
+	TRACE_JNI("loadAxiomStream");
+	// copy the arrays as the loading could take a while
+	std::vector<jint> Codes(env->GetArrayLength(codes));
+	env->GetIntArrayRegion ( codes, 0, (jsize)Codes.size(), Codes.data() );
+	// get the names in the same (modified UTF-8) form as all the other entry points do
+	jsize nNames = env->GetArrayLength(names);
+	std::vector<std::string> Buf;
+	std::vector<const char*> Names;
+	Buf.reserve(nNames);	// no reallocation, so the pointers to the strings stay valid
+	Names.reserve(nNames);
+	for ( jsize i = 0; i < nNames; ++i )
+	{
+		jstring str = (jstring) env->GetObjectArrayElement ( names, i );
+		if ( str == nullptr )
+			Names.push_back(nullptr);
+		else
+		{
+			JString name ( env, str );
+			Buf.emplace_back(name());
+			Names.push_back(Buf.back().c_str());
+		}
+		env->DeleteLocalRef(str);
+	}
+
+	TJNICache* J = getJ(env,obj);
+	AxiomVec Axioms;
+	PROCESS_QUERY ( J->K->loadAxiomStream ( reinterpret_cast<const int*>(Codes.data()), Codes.size(), Names, Axioms ) );
+	if ( env->ExceptionCheck() )
+		return nullptr;
+	return J->buildArray ( Axioms, J->AxiomPointer );
+}
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    isRealised
@@ -138,6 +214,65 @@ JNIEXPORT jboolean JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_is
 	return ret;
 }
 
+/// fill C with the concept expressions from the java array ARR
+static void
+getConceptExprArray ( JNIEnv * env, jobjectArray arr, ReasoningKernel::ConceptVec& C )
+{
+	jsize n = env->GetArrayLength(arr);
+	C.reserve(n);
+	for ( jsize i = 0; i < n; ++i )
+	{
+		jobject elem = env->GetObjectArrayElement ( arr, i );
+		C.push_back(getROConceptExpr(env,elem));
+		env->DeleteLocalRef(elem);
+	}
+}
+
+/// @return java byte array with the packed answers of a batch query
+static jbyteArray
+buildResultBits ( JNIEnv * env, const ReasoningKernel::QueryResultBits& Result )
+{
+	jsize size = (jsize)Result.size();
+	jbyteArray ret = env->NewByteArray(size);
+	env->SetByteArrayRegion ( ret, 0, size, reinterpret_cast<const jbyte*>(Result.data()) );
+	return ret;
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    isClassSatisfiableBatch
+ * Signature: ([Luk/ac/manchester/cs/factplusplus/ClassPointer;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_isClassSatisfiableBatch
+  (JNIEnv * env, jobject obj, jobjectArray arg)
+{
+	MemoryStatistics MS("isClassSatisfiableBatch");
+	TRACE_JNI("isClassSatisfiableBatch");
+	ReasoningKernel::ConceptVec C;
+	getConceptExprArray ( env, arg, C );
+	ReasoningKernel::QueryResultBits Result;
+	PROCESS_SIMPLE_QUERY ( J->K->isSatisfiable ( C, Result ) );
+	return buildResultBits ( env, Result );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    isClassSubsumedByBatch
+ * Signature: ([Luk/ac/manchester/cs/factplusplus/ClassPointer;[Luk/ac/manchester/cs/factplusplus/ClassPointer;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_isClassSubsumedByBatch
+  (JNIEnv * env, jobject obj, jobjectArray arg1, jobjectArray arg2)
+{
+	MemoryStatistics MS("isClassSubsumedByBatch");
+	TRACE_JNI("isClassSubsumedByBatch");
+	ReasoningKernel::ConceptVec C, D;
+	getConceptExprArray ( env, arg1, C );
+	getConceptExprArray ( env, arg2, D );
+	ReasoningKernel::QueryResultBits Result;
+	PROCESS_SIMPLE_QUERY ( J->K->isSubsumedBy ( C, D, Result ) );
+	return buildResultBits ( env, Result );
+}
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    isClassEquivalentTo
@@ -206,6 +341,37 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 	return actor.getElements();
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getClassTaxonomy
+ * Signature: ()[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getClassTaxonomy
+  (JNIEnv * env, jobject obj)
+{
+	MemoryStatistics MS("getClassTaxonomy");
+	TRACE_JNI("getClassTaxonomy");
+	TJNICache* J = getJ(env,obj);
+	ReasoningKernel::NamesVector Names;
+	std::vector<unsigned int> Structure;
+	PROCESS_QUERY ( J->K->getConceptTaxonomy ( Names, Structure ) );
+	// the whole hierarchy goes in one copy
+	jsize size = (jsize)Structure.size();
+	jintArray hierarchy = env->NewIntArray(size);
+	env->SetIntArrayRegion ( hierarchy, 0, size, reinterpret_cast<const jint*>(Structure.data()) );
+	// the names of the same export
+	std::vector<TExpr*> acc;
+	acc.reserve(Names.size());
+	for ( const TNamedEntry* name: Names )
+		acc.push_back(ClassPolicy::buildTree ( J, static_cast<const ClassifiableEntry*>(name) ));
+	jobjectArray names = J->buildArray ( acc, J->ClassPointer );
+	// pack both into Object[]{int[], ClassPointer[]}
+	jobjectArray ret = env->NewObjectArray ( 2, env->FindClass("java/lang/Object"), nullptr );
+	env->SetObjectArrayElement ( ret, 0, hierarchy );
+	env->SetObjectArrayElement ( ret, 1, names );
+	return ret;
+}
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    askEquivalentClasses
@@ -834,6 +1000,28 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getDataValueIndividuals
+ * Signature: (Luk/ac/manchester/cs/factplusplus/DataPropertyPointer;Luk/ac/manchester/cs/factplusplus/DataValuePointer;ZLuk/ac/manchester/cs/factplusplus/DataValuePointer;Z)[Luk/ac/manchester/cs/factplusplus/IndividualPointer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getDataValueIndividuals
+  (JNIEnv * env, jobject obj, jobject arg1, jobject arg2, jboolean minExcl, jobject arg3, jboolean maxExcl)
+{
+	TRACE_JNI("getDataValueIndividuals");
+	TRACE_ARG(env,obj,arg1);
+	TJNICache* J = getJ(env,obj);
+	// NULL bound means an open range
+	TDataValueExpr* Min = arg2 ? getRODataValueExpr(env,arg2) : nullptr;
+	TDataValueExpr* Max = arg3 ? getRODataValueExpr(env,arg3) : nullptr;
+	ReasoningKernel::NamesVector Js;
+	PROCESS_QUERY ( J->K->getDataValueInstances ( getRODRoleExpr(env,arg1), Min, minExcl, Max, maxExcl, Js ) );
+	std::vector<TExpr*> acc;
+	for ( ReasoningKernel::NamesVector::const_iterator p = Js.begin(), p_end = Js.end(); p < p_end; ++p )
+		acc.push_back(J->getIName((*p)->getName()));
+	return J->buildArray ( acc, J->IndividualPointer );
+}
+
 
 #undef PROCESS_QUERY
 #undef PROCESS_SIMPLE_QUERY
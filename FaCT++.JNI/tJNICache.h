@@ -207,20 +207,25 @@ public:		// members
 	{
 		jobjectArray ret = env->NewObjectArray ( (jsize)vec.size(), ID.ClassID, nullptr );
 		for ( unsigned int i = 0; i < vec.size(); ++i )
-			env->SetObjectArrayElement ( ret, (jsize)i, retObject ( vec[i], ID ) );
+		{
+			jobject elem = retObject ( vec[i], ID );
+			env->SetObjectArrayElement ( ret, (jsize)i, elem );
+			// release the local reference: the vector could be large
+			env->DeleteLocalRef(elem);
+		}
 		return ret;
 	}
 
 	// get expressions for the names in the unified way
 
 		/// get expression for the class name
-	TConceptExpr* getCName ( const std::string& name ) { return EM->Concept(name); }
+	TConceptExpr* getCName ( const char* name ) { return EM->Concept(name); }
 		/// get expression for the individual name
-	TIndividualExpr* getIName ( const std::string& name ) { return EM->Individual(name); }
+	TIndividualExpr* getIName ( const char* name ) { return EM->Individual(name); }
 		/// get expression for the object property name
-	TORoleExpr* getOName ( const std::string& name ) { return EM->ObjectRole(name); }
+	TORoleExpr* getOName ( const char* name ) { return EM->ObjectRole(name); }
 		/// get expression for the data property name
-	TDRoleExpr* getDName ( const std::string& name ) { return EM->DataRole(name); }
+	TDRoleExpr* getDName ( const char* name ) { return EM->DataRole(name); }
 }; // TJNICache
 
 /// get JNI cache by the env and obj
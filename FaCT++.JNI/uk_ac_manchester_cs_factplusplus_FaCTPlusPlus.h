@@ -768,6 +768,30 @@ JNIEXPORT jobject JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_tel
 JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_retract
   (JNIEnv *, jobject, jobject);
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    beginBatch
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_beginBatch
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    commitBatch
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_commitBatch
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    loadAxiomStream
+ * Signature: ([I[Ljava/lang/String;)[Luk/ac/manchester/cs/factplusplus/AxiomPointer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_loadAxiomStream
+  (JNIEnv *, jobject, jintArray, jobjectArray);
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    isKBConsistent
@@ -792,6 +816,22 @@ JNIEXPORT jboolean JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_is
 JNIEXPORT jboolean JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_isClassSubsumedBy
   (JNIEnv *, jobject, jobject, jobject);
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    isClassSatisfiableBatch
+ * Signature: ([Luk/ac/manchester/cs/factplusplus/ClassPointer;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_isClassSatisfiableBatch
+  (JNIEnv *, jobject, jobjectArray);
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    isClassSubsumedByBatch
+ * Signature: ([Luk/ac/manchester/cs/factplusplus/ClassPointer;[Luk/ac/manchester/cs/factplusplus/ClassPointer;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_isClassSubsumedByBatch
+  (JNIEnv *, jobject, jobjectArray, jobjectArray);
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    isClassEquivalentTo
@@ -824,6 +864,14 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askSuperClasses
   (JNIEnv *, jobject, jobject, jboolean);
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getClassTaxonomy
+ * Signature: ()[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getClassTaxonomy
+  (JNIEnv *, jobject);
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    askEquivalentClasses
@@ -1128,6 +1176,14 @@ JNIEXPORT jboolean JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_is
 JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getDataRelatedIndividuals
   (JNIEnv *, jobject, jobject, jobject, jint);
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getDataValueIndividuals
+ * Signature: (Luk/ac/manchester/cs/factplusplus/DataPropertyPointer;Luk/ac/manchester/cs/factplusplus/DataValuePointer;ZLuk/ac/manchester/cs/factplusplus/DataValuePointer;Z)[Luk/ac/manchester/cs/factplusplus/IndividualPointer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getDataValueIndividuals
+  (JNIEnv *, jobject, jobject, jobject, jboolean, jobject, jboolean);
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    setOperationTimeout
@@ -1328,6 +1384,22 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getNonLocal
   (JNIEnv *, jobject, jint, jint);
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getModuleCacheHitNumber
+ * Signature: (I)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getModuleCacheHitNumber
+  (JNIEnv *, jobject, jint);
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getSavedLocCheckNumber
+ * Signature: (I)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getSavedLocCheckNumber
+  (JNIEnv *, jobject, jint);
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    checkSaveLoadContext
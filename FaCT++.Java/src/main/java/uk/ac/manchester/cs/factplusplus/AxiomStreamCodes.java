@@ -0,0 +1,98 @@
+package uk.ac.manchester.cs.factplusplus;
+
+/**
+ * Codes of the axiom stream for {@link FaCTPlusPlus#loadAxiomStream(int[], String[])}.
+ * Every axiom and expression is written in prefix form: its code followed by
+ * its arguments. N is the number of the following arguments, M is a
+ * cardinality and K is an index of a name. Must be kept in sync with
+ * Kernel/AxiomStreamCodes.h.
+ */
+public final class AxiomStreamCodes {
+
+    // axioms
+    public static final int DECLARATION = 1; // any expression
+    public static final int CONCEPT_INCLUSION = 2; // C D
+    public static final int EQUIVALENT_CONCEPTS = 3; // N C1 ... Cn
+    public static final int DISJOINT_CONCEPTS = 4; // N C1 ... Cn
+    public static final int DISJOINT_UNION = 5; // C N C1 ... Cn
+    public static final int INVERSE_ROLES = 6; // R S
+    public static final int OROLE_INCLUSION = 7; // R(complex) S
+    public static final int DROLE_INCLUSION = 8; // A B
+    public static final int EQUIVALENT_OROLES = 9; // N R1 ... Rn
+    public static final int EQUIVALENT_DROLES = 10; // N A1 ... An
+    public static final int DISJOINT_OROLES = 11; // N R1 ... Rn
+    public static final int DISJOINT_DROLES = 12; // N A1 ... An
+    public static final int OROLE_DOMAIN = 13; // R C
+    public static final int DROLE_DOMAIN = 14; // A C
+    public static final int OROLE_RANGE = 15; // R C
+    public static final int DROLE_RANGE = 16; // A E
+    public static final int TRANSITIVE = 17; // R
+    public static final int REFLEXIVE = 18; // R
+    public static final int IRREFLEXIVE = 19; // R
+    public static final int SYMMETRIC = 20; // R
+    public static final int ASYMMETRIC = 21; // R
+    public static final int OFUNCTIONAL = 22; // R
+    public static final int DFUNCTIONAL = 23; // A
+    public static final int INVERSE_FUNCTIONAL = 24; // R
+    public static final int INSTANCE_OF = 25; // I C
+    public static final int RELATED_TO = 26; // I R J
+    public static final int RELATED_TO_NOT = 27; // I R J
+    public static final int VALUE_OF = 28; // I A V
+    public static final int VALUE_OF_NOT = 29; // I A V
+    public static final int SAME_INDIVIDUALS = 30; // N I1 ... In
+    public static final int DIFFERENT_INDIVIDUALS = 31; // N I1 ... In
+
+    // concept expressions
+    public static final int CONCEPT_NAME = 64; // K
+    public static final int CONCEPT_TOP = 65;
+    public static final int CONCEPT_BOTTOM = 66;
+    public static final int CONCEPT_NOT = 67; // C
+    public static final int CONCEPT_AND = 68; // N C1 ... Cn
+    public static final int CONCEPT_OR = 69; // N C1 ... Cn
+    public static final int CONCEPT_ONE_OF = 70; // N I1 ... In
+    public static final int OBJECT_SELF = 71; // R
+    public static final int OBJECT_VALUE = 72; // R I
+    public static final int OBJECT_EXISTS = 73; // R C
+    public static final int OBJECT_FORALL = 74; // R C
+    public static final int OBJECT_MIN_CARDINALITY = 75; // M R C
+    public static final int OBJECT_MAX_CARDINALITY = 76; // M R C
+    public static final int OBJECT_CARDINALITY = 77; // M R C
+    public static final int DATA_VALUE_RESTRICTION = 78; // A V
+    public static final int DATA_EXISTS = 79; // A E
+    public static final int DATA_FORALL = 80; // A E
+    public static final int DATA_MIN_CARDINALITY = 81; // M A E
+    public static final int DATA_MAX_CARDINALITY = 82; // M A E
+    public static final int DATA_CARDINALITY = 83; // M A E
+
+    // individual expressions
+    public static final int INDIVIDUAL_NAME = 96; // K
+
+    // role expressions
+    public static final int OBJECT_ROLE_NAME = 112; // K
+    public static final int OBJECT_ROLE_TOP = 113;
+    public static final int OBJECT_ROLE_BOTTOM = 114;
+    public static final int OBJECT_ROLE_INVERSE = 115; // R
+    public static final int OBJECT_ROLE_CHAIN = 116; // N R1 ... Rn
+    public static final int OBJECT_ROLE_PROJECT_FROM = 117; // R C
+    public static final int OBJECT_ROLE_PROJECT_INTO = 118; // R C
+    public static final int DATA_ROLE_NAME = 119; // K
+    public static final int DATA_ROLE_TOP = 120;
+    public static final int DATA_ROLE_BOTTOM = 121;
+
+    // data expressions
+    public static final int DATA_TOP = 128;
+    public static final int DATA_BOTTOM = 129;
+    public static final int DATA_TYPE_NAME = 130; // K
+    public static final int DATA_TYPE_RESTRICTION = 131; // T N F1 ... Fn
+    public static final int DATA_VALUE = 132; // K T: value given by the name K of the type T
+    public static final int DATA_NOT = 133; // E
+    public static final int DATA_AND = 134; // N E1 ... En
+    public static final int DATA_OR = 135; // N E1 ... En
+    public static final int DATA_ONE_OF = 136; // N V1 ... Vn
+    public static final int FACET_MIN_INCLUSIVE = 137; // V
+    public static final int FACET_MIN_EXCLUSIVE = 138; // V
+    public static final int FACET_MAX_INCLUSIVE = 139; // V
+    public static final int FACET_MAX_EXCLUSIVE = 140; // V
+
+    private AxiomStreamCodes() {}
+}
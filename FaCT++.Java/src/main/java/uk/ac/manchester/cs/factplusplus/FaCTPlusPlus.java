@@ -1246,6 +1246,51 @@ public class FaCTPlusPlus {
      */
     public native void retract(AxiomPointer a) throws FaCTPlusPlusException;
 
+    // ------------------------------------------------------------------------
+    // Batch updates
+    // ------------------------------------------------------------------------
+    /**
+     * Start collecting axiom additions and retractions into a batch. Queries
+     * are answered wrt the last committed ontology until the batch is
+     * committed.
+     *
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native void beginBatch() throws FaCTPlusPlusException;
+
+    /**
+     * Validate the changes of the batch and process them in one go. If the
+     * validation fails, the bad retractions are cancelled and the batch stays
+     * open.
+     *
+     * @return report about the batch: numbers of added and retracted axioms,
+     *         number of ontology reloads saved (changed versions of the
+     *         ontology queried during the batch), and the time of the
+     *         re-reasoning in milliseconds
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native long[] commitBatch() throws FaCTPlusPlusException;
+
+    // ------------------------------------------------------------------------
+    // Bulk loading
+    // ------------------------------------------------------------------------
+    /**
+     * Add all the axioms of a serialised ontology in one call. If the stream
+     * is malformed, the axioms read before the error stay in the ontology.
+     *
+     * @param codes
+     *        axiom stream, see {@link AxiomStreamCodes}
+     * @param names
+     *        names referred from the stream by their index
+     * @return pointers to the added axioms, e.g. for {@link #retract}
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native AxiomPointer[] loadAxiomStream(int[] codes, String[] names)
+            throws FaCTPlusPlusException;
+
     // ------------------------------------------------------------------------
     // ASK queries
     // ------------------------------------------------------------------------
@@ -1284,6 +1329,34 @@ public class FaCTPlusPlus {
     public native boolean isClassSubsumedBy(ClassPointer c, ClassPointer d)
             throws FaCTPlusPlusException;
 
+    /**
+     * Checks satisfiability of a batch of classes in one call.
+     *
+     * @param c
+     *        pointers
+     * @return packed answers: c[i] is satisfiable iff the bit (i%8) of the
+     *         byte i/8 is set (the layout of BitSet.valueOf(byte[]))
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native byte[] isClassSatisfiableBatch(ClassPointer[] c)
+            throws FaCTPlusPlusException;
+
+    /**
+     * Checks subsumption for a batch of class pairs in one call.
+     *
+     * @param c
+     *        pointers to the sub-classes
+     * @param d
+     *        pointers to the super-classes; the same length as c
+     * @return packed answers: c[i] is subsumed by d[i] iff the bit (i%8) of
+     *         the byte i/8 is set (the layout of BitSet.valueOf(byte[]))
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native byte[] isClassSubsumedByBatch(ClassPointer[] c,
+            ClassPointer[] d) throws FaCTPlusPlusException;
+
     /**
      * Checks if is class equivalent to.
      *
@@ -1341,6 +1414,21 @@ public class FaCTPlusPlus {
     public native ClassPointer[][] askSuperClasses(ClassPointer c,
             boolean direct) throws FaCTPlusPlusException;
 
+    /**
+     * Exports the whole classified class hierarchy in one call. Vertices are
+     * numbered from 0, which is the vertex of Nothing; 1 is the vertex of
+     * Thing. The first element of the result is an int[]: the number of
+     * vertices followed by, for every vertex, the number of its classes, the
+     * number of its direct super-vertices and their numbers. The second
+     * element is a ClassPointer[] with the classes of the same export: the
+     * classes of vertex 0 go first, then the classes of vertex 1, etc.
+     *
+     * @return packed hierarchy and its classes
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native Object[] getClassTaxonomy() throws FaCTPlusPlusException;
+
     /**
      * Ask equivalent classes.
      *
@@ -1853,6 +1941,29 @@ public class FaCTPlusPlus {
             DataPropertyPointer r, DataPropertyPointer s, int op)
             throws FaCTPlusPlusException;
 
+    /**
+     * Gets the individuals with a value of a data property in a range. Only
+     * the asserted values are used.
+     *
+     * @param r
+     *        pointer
+     * @param min
+     *        lower bound of the range; null for no bound
+     * @param minExclusive
+     *        true iff the lower bound is exclusive
+     * @param max
+     *        upper bound of the range; null for no bound
+     * @param maxExclusive
+     *        true iff the upper bound is exclusive
+     * @return the individuals with r-values in the range
+     * @throws FaCTPlusPlusException
+     *         fact exception
+     */
+    public native IndividualPointer[] getDataValueIndividuals(
+            DataPropertyPointer r, DataValuePointer min, boolean minExclusive,
+            DataValuePointer max, boolean maxExclusive)
+            throws FaCTPlusPlusException;
+
     // ------------------------------------------------------------------------
     // Options
     // ------------------------------------------------------------------------
@@ -2110,6 +2221,24 @@ public class FaCTPlusPlus {
      */
     public native AxiomPointer[] getNonLocal(int moduleMethod, int moduleType);
 
+    /**
+     * Gets the number of modules taken from the module cache.
+     *
+     * @param moduleMethod
+     *        the module method
+     * @return the number of module cache hits
+     */
+    public native long getModuleCacheHitNumber(int moduleMethod);
+
+    /**
+     * Gets the number of locality checks saved by the module cache.
+     *
+     * @param moduleMethod
+     *        the module method
+     * @return the saved loc check number
+     */
+    public native long getSavedLocCheckNumber(int moduleMethod);
+
     // ------------------------------------------------------------------------
     // Save/Load interface
     // ------------------------------------------------------------------------
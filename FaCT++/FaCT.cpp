@@ -276,6 +276,9 @@ int main ( int argc, char *argv[] )
 	// dump ontology if requested
 	Kernel.setDumpOntology(Kernel.getOptions()->getBool("dumpOntology"));
 
+	// add new ABox assertions without reload if requested
+	Kernel.setUseIncrementalABox(Kernel.getOptions()->getBool("useIncrementalABox"));
+
 	// Load the ontology
 	DLLispParser TBoxParser ( &iTBox, &Kernel );
 	Kernel.setVerboseOutput(true);
@@ -18,10 +18,16 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
 #include <ostream>
+#include <sstream>
+#include <unordered_map>
+#include <algorithm>
 
 #include "AtomicDecomposer.h"
 #include "logging.h"
 #include "ProgressIndicatorInterface.h"
+#include "procTimer.h"
+#include "SaveLoadManager.h"
+#include "tOntologyPrinterLISP.h"
 
 //#define RKG_DEBUG_AD
 
@@ -150,5 +156,265 @@ AtomicDecomposer :: getAOS ( TOntology* O, ModuleType t )
 	// reduce graph
 	AOS->reduceGraph();
 
+	nAxioms = O->size();
+	return AOS;
+}
+
+/// update the atomic structure wrt axioms added to or retracted from O since it was built
+bool
+AtomicDecomposer :: updateAOS ( TOntology* O )
+{
+	fpp_assert ( AOS != nullptr );
+
+	// gather new axioms and the retracted ones that were in some atom
+	AxiomVec Added, Removed;
+	for ( size_t i = nAxioms; i < O->size(); ++i )
+		if ( O->getAxioms()[i]->isUsed() )
+			Added.push_back(O->getAxioms()[i]);
+	for ( size_t i = 0; i < nAxioms; ++i )
+		if ( !O->getAxioms()[i]->isUsed() && O->getAxioms()[i]->getAtom() != nullptr )
+			Removed.push_back(O->getAxioms()[i]);
+	bool hasRetractedTautologies = false;
+	for ( TDLAxiom* axiom : Tautologies )
+		hasRetractedTautologies |= !axiom->isUsed();
+	if ( Added.empty() && Removed.empty() && !hasRetractedTautologies )
+		return false;
+
+	// STAR-modules are not updated incrementally
+	if ( type == M_STAR )
+	{
+		getAOS ( O, type );
+		return true;
+	}
+
+	TsProcTimer timer;
+	timer.Start();
+	unsigned long long nChecks = pModularizer->getNChecks();
+	nAxioms = O->size();
+	Tautologies.erase ( std::remove_if ( Tautologies.begin(), Tautologies.end(), [] ( TDLAxiom* axiom ) { return !axiom->isUsed(); } ), Tautologies.end() );
+	pModularizer->preprocessOntology(O->getAxioms());
+
+	// tautologies do not change the structure
+	AxiomVec NewAxioms;
+	for ( TDLAxiom* axiom : Added )
+		if ( pModularizer->isTautology(axiom, type) )
+			Tautologies.push_back(axiom);
+		else if ( pModularizer->isInAllModules(axiom, type) )
+		{	// axiom that is in every module changes all the atoms
+			getAOS ( O, type );
+			return true;
+		}
+		else
+			NewAxioms.push_back(axiom);
+
+	// atoms with the removed axioms in their modules are affected
+	const size_t nAtoms = AOS->size();
+	std::vector<bool> HasRemoved ( nAtoms, false ), Affected ( nAtoms, false );
+	for ( TDLAxiom* axiom : Removed )
+		HasRemoved[axiom->getAtom()->getId()] = true;
+	// locality of new axioms depends only on their own names; find which of them are in the module signatures
+	std::vector<TSignature> ModuleNames(nAtoms);
+	for ( TDLAxiom* axiom : NewAxioms )
+		for ( const TNamedEntity* entity : axiom->getSignature() )
+			for ( TDLAxiom* ax : pModularizer->getSigIndex()->getAxioms(entity) )
+				if ( ax->getAtom() != nullptr )
+					ModuleNames[ax->getAtom()->getId()].add(entity);
+	for ( TOntologyAtom* atom : *AOS )
+	{
+		const size_t id = atom->getId();
+		for ( TOntologyAtom* dep : atom->getAllDepAtoms() )
+		{
+			HasRemoved[id] = HasRemoved[id] || HasRemoved[dep->getId()];
+			ModuleNames[id].add(ModuleNames[dep->getId()]);
+		}
+		Affected[id] = HasRemoved[id];
+		if ( Affected[id] || ModuleNames[id].size() == 0 )
+			continue;
+		// module of the atom is changed iff some new axiom is non-local wrt its signature
+		for ( TDLAxiom* axiom : NewAxioms )
+			if ( pModularizer->isNonLocal ( axiom, ModuleNames[id], type ) )
+			{
+				Affected[id] = true;
+				break;
+			}
+	}
+
+	// remove the affected atoms; all the axioms from them and new ones should be decomposed again
+	AxiomVec Free;
+	AOS->removeAtoms ( Affected, Free );
+	const size_t nKept = AOS->size();
+	Free.insert ( Free.end(), NewAxioms.begin(), NewAxioms.end() );
+	std::sort ( Free.begin(), Free.end(), [] ( const TDLAxiom* a1, const TDLAxiom* a2 ) { return a1->getId() < a2->getId(); } );
+
+	for ( TDLAxiom* axiom : Tautologies )
+		axiom->setUsed(false);
+	rootAtom = new TOntologyAtom();
+	rootAtom -> setModule ( TOntologyAtom::AxiomSet ( O->begin(), O->end() ) );
+	for ( TDLAxiom* axiom : Free )
+		if ( axiom->isUsed() && axiom->getAtom() == nullptr )
+			createAtom ( axiom, rootAtom );
+	restoreTautologies();
+	delete rootAtom;
+
+	// only the new atoms need their dependencies to be reduced
+	AOS->reduceGraph(nKept);
+
+	timer.Stop();
+	if ( LLM.isWritable(llAlways) )
+		LL << "\nAtomic structure updated in " << timer << " seconds: " << nAtoms-nKept << " of " << nAtoms << " atoms rebuilt as "
+		   << AOS->size()-nKept << " atoms using " << pModularizer->getNChecks()-nChecks << " locality checks\n";
+
+	return true;
+}
+
+//----------------------------------------------------------
+//-- save/load of the atomic structure
+//----------------------------------------------------------
+
+const char* AtomicDecomposer :: ADFileHeader = "FaCT++AtomicDecomposition1.0";
+
+/// @return fingerprint of the ontology O: hash of the textual representation of its axioms
+static unsigned long long
+getFingerprint ( TOntology* O )
+{
+	// 64-bit FNV-1a hash
+	unsigned long long hash = 14695981039346656037ULL;
+	std::ostringstream s;
+	TLISPOntologyPrinter LP(s);
+	for ( const TDLAxiom* axiom : *O )
+	{
+		s.str("");
+		s << axiom->isUsed();
+		axiom->accept(LP);
+		for ( char c : s.str() )
+		{
+			hash ^= (unsigned char)c;
+			hash *= 1099511628211ULL;
+		}
+	}
+	return hash;
+}
+
+/// save the atomic structure of the ontology O built using METHOD
+void
+AtomicDecomposer :: Save ( SaveLoadManager& m, TOntology* O, ModuleMethod method ) const
+{
+	fpp_assert ( AOS != nullptr );
+	m.o() << ADFileHeader << "\n" << std::hex << getFingerprint(O) << std::dec << "\n";
+	m.saveUInt(method);
+	m.saveUInt(type);
+	m.saveUInt(O->size());
+
+	// axioms are saved by their positions in the ontology
+	std::unordered_map<const TDLAxiom*, unsigned int> AxiomIndex;
+	unsigned int n = 0;
+	for ( const TDLAxiom* axiom : *O )
+		AxiomIndex[axiom] = n++;
+
+	// modules are not saved: every module is a union of the atom and all atoms it depends on
+	m.saveUInt(AOS->size());
+	std::vector<unsigned int> ids;
+	for ( const TOntologyAtom* atom : *AOS )
+	{
+		m.o() << "\nA";
+		// save atom axioms as a sorted list of gaps between axiom indices
+		ids.clear();
+		for ( const TDLAxiom* axiom : atom->getAtomAxioms() )
+			ids.push_back(AxiomIndex[axiom]);
+		std::sort ( ids.begin(), ids.end() );
+		m.saveUInt(ids.size());
+		unsigned int last = 0;
+		for ( unsigned int id : ids )
+		{
+			m.saveUInt(id-last);
+			last = id;
+		}
+		// save direct dependencies
+		m.saveUInt(atom->getDepAtoms().size());
+		for ( const TOntologyAtom* dep : atom->getDepAtoms() )
+			m.saveUInt(dep->getId());
+	}
+	m.o() << "\n";
+	m.checkStream();
+}
+
+/// load the atomic structure of the ontology O for given METHOD and TYPE
+AOStructure*
+AtomicDecomposer :: Load ( SaveLoadManager& m, TOntology* O, ModuleMethod method, ModuleType t )
+{
+	// check that the saved AD corresponds to the ontology
+	std::string str;
+	m.i() >> str;
+	if ( str != ADFileHeader )
+		throw EFPPSaveLoad("Incompatible atomic decomposition header");
+	unsigned long long fingerprint = 0;
+	m.i() >> std::hex >> fingerprint >> std::dec;
+	m.checkStream();
+	if ( fingerprint != getFingerprint(O) || m.loadUInt() != (unsigned int)method ||
+		 m.loadUInt() != (unsigned int)t || m.loadUInt() != O->size() )
+		throw EFPPSaveLoad("Saved atomic decomposition was built for a different ontology");
+
+	// remember the type of the module
+	type = t;
+
+	// prepare a new AO structure
+	delete AOS;
+	AOS = new AOStructure();
+
+	unsigned int size = m.loadUInt();
+	for ( unsigned int i = 0; i < size; ++i )
+		AOS->newAtom();
+
+	// load atoms; remember axiom indices to build the modules
+	std::vector<std::vector<unsigned int>> AtomIndices(size);
+	for ( unsigned int i = 0; i < size; ++i )
+	{
+		TOntologyAtom* atom = (*AOS)[i];
+		m.expectChar('A');
+		unsigned int nAx = m.loadUInt();
+		unsigned int id = 0;
+		for ( unsigned int k = 0; k < nAx; ++k )
+		{
+			id += m.loadUInt();
+			if ( id >= O->size() || O->getAxioms()[id]->getAtom() != nullptr )
+				throw EFPPSaveLoad("Wrong axiom index in the saved atomic decomposition");
+			atom->addAxiom(O->getAxioms()[id]);
+			AtomIndices[i].push_back(id);
+		}
+		unsigned int nDep = m.loadUInt();
+		for ( unsigned int k = 0; k < nDep; ++k )
+		{
+			unsigned int dep = m.loadUInt();
+			if ( dep >= size )
+				throw EFPPSaveLoad("Wrong atom index in the saved atomic decomposition");
+			atom->addDepAtom((*AOS)[dep]);
+		}
+		m.checkStream();
+	}
+
+	AOS->reduceGraph();
+
+	// all the used axioms outside atoms are tautologies
+	Tautologies.clear();
+	for ( TDLAxiom* axiom : *O )
+		if ( axiom->isUsed() && axiom->getAtom() == nullptr )
+			Tautologies.push_back(axiom);
+	nAxioms = O->size();
+
+	// restore modules from the atoms
+	std::vector<unsigned int> ids;
+	for ( TOntologyAtom* atom : *AOS )
+	{
+		ids = AtomIndices[atom->getId()];
+		for ( const TOntologyAtom* dep : atom->getAllDepAtoms() )
+			ids.insert ( ids.end(), AtomIndices[dep->getId()].begin(), AtomIndices[dep->getId()].end() );
+		std::sort ( ids.begin(), ids.end() );
+		TOntologyAtom::AxiomSet Module;
+		Module.reserve(ids.size());
+		for ( unsigned int id : ids )
+			Module.push_back(O->getAxioms()[id]);
+		atom->setModule(Module);
+	}
+
 	return AOS;
 }
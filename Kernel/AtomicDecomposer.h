@@ -25,6 +25,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "Modularity.h"
 
 class ProgressIndicatorInterface;
+class SaveLoadManager;
 
 /// atomic ontology structure
 class AOStructure
@@ -40,11 +41,15 @@ protected:	// members
 	AtomVec Atoms;
 
 public:		// interface
-		/// d'tor: delete all atoms
+		/// d'tor: delete all atoms; release their axioms
 	~AOStructure()
 	{
 		for ( TOntologyAtom* atom : Atoms )
+		{
+			for ( TDLAxiom* axiom : atom->getAtomAxioms() )
+				axiom->setAtom(nullptr);
 			delete atom;
+		}
 	}
 
 		/// create a new atom and get a pointer to it
@@ -55,12 +60,33 @@ public:		// interface
 		Atoms.push_back(ret);
 		return ret;
 	}
-		/// reduce graph of the atoms in the structure
-	void reduceGraph ( void )
+		/// reduce graph of the atoms in the structure starting from FIRST; the graph of the previous atoms is already reduced
+	void reduceGraph ( size_t first = 0 )
 	{
-		TOntologyAtom::AtomSet checked;
+		TOntologyAtom::AtomSet checked ( Atoms.begin(), Atoms.begin()+first );
+		for ( iterator p = Atoms.begin()+first, p_end = Atoms.end(); p != p_end; ++p )
+			(*p)->getAllDepAtoms(checked);
+	}
+		/// remove all the atoms with REMOVE[id] set; put their axioms into FREED; renumber the rest keeping the order
+	void removeAtoms ( const std::vector<bool>& Remove, AxiomVec& Freed )
+	{
+		size_t n = 0;
 		for ( TOntologyAtom* atom : Atoms )
-			atom->getAllDepAtoms(checked);
+			if ( Remove[atom->getId()] )
+			{
+				for ( TDLAxiom* axiom : atom->getAtomAxioms() )
+				{
+					axiom->setAtom(nullptr);
+					Freed.push_back(axiom);
+				}
+				delete atom;
+			}
+			else
+			{
+				atom->setId(n);
+				Atoms[n++] = atom;
+			}
+		Atoms.resize(n);
 	}
 
 		/// RW iterator begin
@@ -91,6 +117,11 @@ protected:	// members
 	TOntologyAtom* rootAtom = nullptr;
 		/// module type for current AOS creation
 	ModuleType type;
+		/// number of ontology axioms processed by the AOS
+	size_t nAxioms = 0;
+
+		/// header of the file with the saved AD; defined in AtomicDecomposer.cpp
+	static const char* ADFileHeader;
 
 protected:	// methods
 		/// remove tautologies (axioms that are always local) from the ontology temporarily
@@ -114,13 +145,25 @@ public:		// interface
 
 		/// get the atomic structure for given module type TYPE
 	AOStructure* getAOS ( TOntology* O, ModuleType type );
+		/// update the atomic structure wrt axioms added to or retracted from O since it was built; @return true iff it was changed
+	bool updateAOS ( TOntology* O );
 		/// get already created atomic structure
 	const AOStructure* getAOS ( void ) const { return AOS; }
+		/// get the module type of the atomic structure
+	ModuleType getType ( void ) const { return type; }
+
+		/// save the atomic structure of the ontology O built using METHOD
+	void Save ( SaveLoadManager& m, TOntology* O, ModuleMethod method ) const;
+		/// load the atomic structure of the ontology O for given METHOD and TYPE;
+		/// @throw EFPPSaveLoad if the saved structure was built for a different ontology, method or type
+	AOStructure* Load ( SaveLoadManager& m, TOntology* O, ModuleMethod method, ModuleType type );
 
 		/// set progress indicator to be PI
 	void setProgressIndicator ( ProgressIndicatorInterface* pi ) { PI = pi; }
 		/// get number of performed locality checks
 	unsigned long long getLocCheckNumber(void) const { return pModularizer->getNChecks(); }
+		/// get the locality checker used to build the atomic structure
+	const LocalityChecker* getLocalityChecker ( void ) const { return pModularizer->getLocalityChecker(); }
 }; // AtomicDecomposer
 
 #endif
@@ -0,0 +1,557 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+// bulk loading of the axioms from the axiom stream
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Kernel.h"
+#include "AxiomStreamCodes.h"
+#include "eFPPSaveLoad.h"
+
+/// reader of the axiom stream; builds expressions and axioms directly in the kernel
+class AxiomStreamReader
+{
+protected:	// types
+		/// concept expression
+	typedef ReasoningKernel::TConceptExpr TConceptExpr;
+		/// individual expression
+	typedef ReasoningKernel::TIndividualExpr TIndividualExpr;
+		/// object role expression
+	typedef ReasoningKernel::TORoleExpr TORoleExpr;
+		/// object role complex expression
+	typedef ReasoningKernel::TORoleComplexExpr TORoleComplexExpr;
+		/// data role expression
+	typedef ReasoningKernel::TDRoleExpr TDRoleExpr;
+		/// data expression
+	typedef ReasoningKernel::TDataExpr TDataExpr;
+		/// data type expression
+	typedef ReasoningKernel::TDataTypeExpr TDataTypeExpr;
+		/// data value expression
+	typedef ReasoningKernel::TDataValueExpr TDataValueExpr;
+		/// data facet expression
+	typedef ReasoningKernel::TFacetExpr TFacetExpr;
+
+protected:	// members
+		/// kernel to load axioms to
+	ReasoningKernel& Kernel;
+		/// expression manager of the kernel
+	TExpressionManager* EM;
+		/// start of the stream
+	const int* Begin;
+		/// current position in the stream
+	const int* Cur;
+		/// end of the stream
+	const int* End;
+		/// names used in the stream
+	const std::vector<const char*>& Names;
+		/// entities already made for the names: the code of the entity kind and the entity itself
+	std::vector<std::pair<int, const TDLExpression*>> Entities;
+
+protected:	// methods
+		/// report an error MSG at the current position
+	[[noreturn]] void error ( const char* msg ) const
+	{
+		throw EFPPSaveLoad ( std::string("Axiom stream: ") + msg + " at position " + std::to_string(Cur - Begin - 1) );
+	}
+		/// @return the next element of the stream
+	int next ( void )
+	{
+		if ( unlikely(Cur == End) )
+			error("unexpected end of stream");
+		return *Cur++;
+	}
+		/// @return the next element of the stream as a non-negative number
+	unsigned int number ( void )
+	{
+		int n = next();
+		if ( unlikely(n < 0) )
+			error("negative number");
+		return static_cast<unsigned int>(n);
+	}
+		/// @return the index of the name given by the next element of the stream
+	unsigned int nameIndex ( void )
+	{
+		unsigned int k = number();
+		if ( unlikely(k >= Names.size() || Names[k] == nullptr) )
+			error("bad name index");
+		return k;
+	}
+		/// @return the name given by the next element of the stream
+	const char* name ( void ) { return Names[nameIndex()]; }
+		/// @return the entity of the kind CODE with the name given by the next element of the stream.
+		/// MAKE is called only for the first occurrence of the name, so the name set lookup is not repeated
+	template<class Entity>
+	const Entity* entity ( int code, Entity* (TExpressionManager::*make)(const char*) )
+	{
+		unsigned int k = nameIndex();
+		std::pair<int, const TDLExpression*>& entry = Entities[k];
+		if ( entry.first != code )
+		{
+			entry.first = code;
+			entry.second = (EM->*make)(Names[k]);
+		}
+		return static_cast<const Entity*>(entry.second);
+	}
+		/// read the number of arguments and then the arguments by READ; put them into a new arg-list
+	template<class Reader>
+	void args ( Reader read )
+	{
+		unsigned int n = number();
+		// every argument takes at least one element of the stream
+		if ( unlikely(n > static_cast<size_t>(End - Cur)) )
+			error("too many arguments");
+		// collect the arguments before opening the list as they could use arg-lists themselves
+		std::vector<const TDLExpression*> Args;
+		Args.reserve(n);
+		for ( unsigned int i = 0; i < n; ++i )
+			Args.push_back(read());
+		EM->newArgList();
+		for ( const TDLExpression* arg: Args )
+			EM->addArg(arg);
+	}
+
+	// readers of the expressions of the particular kind
+
+		/// read a concept expression
+	TConceptExpr* concept ( void );
+		/// read an individual expression
+	TIndividualExpr* individual ( void )
+	{
+		if ( next() != ascIndividualName )
+			error("individual expected");
+		return entity ( ascIndividualName, &TExpressionManager::Individual );
+	}
+		/// read an object role expression
+	TORoleExpr* oRole ( void );
+		/// read an object role expression or a role chain/projection
+	TORoleComplexExpr* oRoleComplex ( void );
+		/// read a data role expression
+	TDRoleExpr* dRole ( void );
+		/// read a data expression
+	TDataExpr* data ( void );
+		/// read a data type expression
+	TDataTypeExpr* dataType ( void )
+	{
+		TDataTypeExpr* type = dynamic_cast<TDataTypeExpr*>(const_cast<TDLDataExpression*>(data()));
+		if ( type == nullptr )
+			error("data type expected");
+		return type;
+	}
+		/// read a data value expression
+	TDataValueExpr* dataValue ( void )
+	{
+		if ( next() != ascDataValue )
+			error("data value expected");
+		const char* value = name();
+		return EM->DataValue ( value, dataType() );
+	}
+		/// read a facet expression
+	TFacetExpr* facet ( void );
+		/// read an expression of any kind
+	const TDLExpression* expression ( void );
+
+		/// read an axiom and add it to the kernel; @return the axiom
+	TDLAxiom* axiom ( void );
+
+public:		// interface
+		/// init c'tor
+	AxiomStreamReader ( ReasoningKernel& kernel, const int* codes, size_t nCodes, const std::vector<const char*>& names )
+		: Kernel(kernel)
+		, EM(kernel.getExpressionManager())
+		, Begin(codes)
+		, Cur(codes)
+		, End(codes+nCodes)
+		, Names(names)
+		, Entities(names.size())
+		{}
+
+		/// load all the axioms; put them into AXIOMS
+	void load ( AxiomVec& Axioms )
+	{
+		while ( Cur != End )
+			Axioms.push_back(axiom());
+	}
+}; // AxiomStreamReader
+
+ReasoningKernel::TConceptExpr*
+AxiomStreamReader :: concept ( void )
+{
+	switch ( next() )
+	{
+	case ascConceptName:
+		return entity ( ascConceptName, &TExpressionManager::Concept );
+	case ascConceptTop:
+		return EM->Top();
+	case ascConceptBottom:
+		return EM->Bottom();
+	case ascConceptNot:
+		return EM->Not(concept());
+	case ascConceptAnd:
+		args ( [this] { return concept(); } );
+		return EM->And();
+	case ascConceptOr:
+		args ( [this] { return concept(); } );
+		return EM->Or();
+	case ascConceptOneOf:
+		args ( [this] { return individual(); } );
+		return EM->OneOf();
+	case ascObjectSelf:
+		return EM->SelfReference(oRole());
+	case ascObjectValue:
+	{
+		TORoleExpr* R = oRole();
+		return EM->Value ( R, individual() );
+	}
+	case ascObjectExists:
+	{
+		TORoleExpr* R = oRole();
+		return EM->Exists ( R, concept() );
+	}
+	case ascObjectForall:
+	{
+		TORoleExpr* R = oRole();
+		return EM->Forall ( R, concept() );
+	}
+	case ascObjectMinCardinality:
+	{
+		unsigned int n = number();
+		TORoleExpr* R = oRole();
+		return EM->MinCardinality ( n, R, concept() );
+	}
+	case ascObjectMaxCardinality:
+	{
+		unsigned int n = number();
+		TORoleExpr* R = oRole();
+		return EM->MaxCardinality ( n, R, concept() );
+	}
+	case ascObjectCardinality:
+	{
+		unsigned int n = number();
+		TORoleExpr* R = oRole();
+		return EM->Cardinality ( n, R, concept() );
+	}
+	case ascDataValueRestriction:
+	{
+		TDRoleExpr* A = dRole();
+		return EM->Value ( A, dataValue() );
+	}
+	case ascDataExists:
+	{
+		TDRoleExpr* A = dRole();
+		return EM->Exists ( A, data() );
+	}
+	case ascDataForall:
+	{
+		TDRoleExpr* A = dRole();
+		return EM->Forall ( A, data() );
+	}
+	case ascDataMinCardinality:
+	{
+		unsigned int n = number();
+		TDRoleExpr* A = dRole();
+		return EM->MinCardinality ( n, A, data() );
+	}
+	case ascDataMaxCardinality:
+	{
+		unsigned int n = number();
+		TDRoleExpr* A = dRole();
+		return EM->MaxCardinality ( n, A, data() );
+	}
+	case ascDataCardinality:
+	{
+		unsigned int n = number();
+		TDRoleExpr* A = dRole();
+		return EM->Cardinality ( n, A, data() );
+	}
+	default:
+		error("concept expression expected");
+	}
+}
+
+ReasoningKernel::TORoleExpr*
+AxiomStreamReader :: oRole ( void )
+{
+	switch ( next() )
+	{
+	case ascObjectRoleName:
+		return entity ( ascObjectRoleName, &TExpressionManager::ObjectRole );
+	case ascObjectRoleTop:
+		return EM->ObjectRoleTop();
+	case ascObjectRoleBottom:
+		return EM->ObjectRoleBottom();
+	case ascObjectRoleInverse:
+		return EM->Inverse(oRole());
+	default:
+		error("object role expression expected");
+	}
+}
+
+ReasoningKernel::TORoleComplexExpr*
+AxiomStreamReader :: oRoleComplex ( void )
+{
+	if ( unlikely(Cur == End) )
+		error("unexpected end of stream");
+	switch ( *Cur )
+	{
+	case ascObjectRoleChain:
+		++Cur;
+		args ( [this] { return oRole(); } );
+		return EM->Compose();
+	case ascObjectRoleProjectFrom:
+	{
+		++Cur;
+		TORoleExpr* R = oRole();
+		return EM->ProjectFrom ( R, concept() );
+	}
+	case ascObjectRoleProjectInto:
+	{
+		++Cur;
+		TORoleExpr* R = oRole();
+		return EM->ProjectInto ( R, concept() );
+	}
+	default:
+		return oRole();
+	}
+}
+
+ReasoningKernel::TDRoleExpr*
+AxiomStreamReader :: dRole ( void )
+{
+	switch ( next() )
+	{
+	case ascDataRoleName:
+		return entity ( ascDataRoleName, &TExpressionManager::DataRole );
+	case ascDataRoleTop:
+		return EM->DataRoleTop();
+	case ascDataRoleBottom:
+		return EM->DataRoleBottom();
+	default:
+		error("data role expression expected");
+	}
+}
+
+ReasoningKernel::TDataExpr*
+AxiomStreamReader :: data ( void )
+{
+	switch ( next() )
+	{
+	case ascDataTop:
+		return EM->DataTop();
+	case ascDataBottom:
+		return EM->DataBottom();
+	case ascDataTypeName:
+		return entity ( ascDataTypeName, &TExpressionManager::DataType );
+	case ascDataTypeRestriction:
+	{
+		TDataTypeExpr* type = dataType();
+		unsigned int n = number();
+		if ( n == 0 )
+			return type;
+		for ( unsigned int i = 0; i < n; ++i )
+			type = EM->RestrictedType ( type, facet() );
+		return type;
+	}
+	case ascDataValue:
+		--Cur;
+		return dataValue();
+	case ascDataNot:
+		return EM->DataNot(data());
+	case ascDataAnd:
+		args ( [this] { return data(); } );
+		return EM->DataAnd();
+	case ascDataOr:
+		args ( [this] { return data(); } );
+		return EM->DataOr();
+	case ascDataOneOf:
+		args ( [this] { return dataValue(); } );
+		return EM->DataOneOf();
+	default:
+		error("data expression expected");
+	}
+}
+
+ReasoningKernel::TFacetExpr*
+AxiomStreamReader :: facet ( void )
+{
+	switch ( next() )
+	{
+	case ascFacetMinInclusive:
+		return EM->FacetMinInclusive(dataValue());
+	case ascFacetMinExclusive:
+		return EM->FacetMinExclusive(dataValue());
+	case ascFacetMaxInclusive:
+		return EM->FacetMaxInclusive(dataValue());
+	case ascFacetMaxExclusive:
+		return EM->FacetMaxExclusive(dataValue());
+	default:
+		error("facet expression expected");
+	}
+}
+
+const TDLExpression*
+AxiomStreamReader :: expression ( void )
+{
+	if ( unlikely(Cur == End) )
+		error("unexpected end of stream");
+	int code = *Cur;
+	if ( code >= ascDataTop )
+		return data();
+	if ( code >= ascObjectRoleName )
+		return code >= ascDataRoleName ? static_cast<const TDLExpression*>(dRole()) : oRoleComplex();
+	if ( code >= ascIndividualName )
+		return individual();
+	return concept();
+}
+
+TDLAxiom*
+AxiomStreamReader :: axiom ( void )
+{
+	switch ( next() )
+	{
+	case ascDeclaration:
+		return Kernel.declare(expression());
+	case ascConceptInclusion:
+	{
+		TConceptExpr* C = concept();
+		return Kernel.impliesConcepts ( C, concept() );
+	}
+	case ascEquivalentConcepts:
+		args ( [this] { return concept(); } );
+		return Kernel.equalConcepts();
+	case ascDisjointConcepts:
+		args ( [this] { return concept(); } );
+		return Kernel.disjointConcepts();
+	case ascDisjointUnion:
+	{
+		TConceptExpr* C = concept();
+		args ( [this] { return concept(); } );
+		return Kernel.disjointUnion(C);
+	}
+	case ascInverseRoles:
+	{
+		TORoleExpr* R = oRole();
+		return Kernel.setInverseRoles ( R, oRole() );
+	}
+	case ascORoleInclusion:
+	{
+		TORoleComplexExpr* R = oRoleComplex();
+		return Kernel.impliesORoles ( R, oRole() );
+	}
+	case ascDRoleInclusion:
+	{
+		TDRoleExpr* A = dRole();
+		return Kernel.impliesDRoles ( A, dRole() );
+	}
+	case ascEquivalentORoles:
+		args ( [this] { return oRole(); } );
+		return Kernel.equalORoles();
+	case ascEquivalentDRoles:
+		args ( [this] { return dRole(); } );
+		return Kernel.equalDRoles();
+	case ascDisjointORoles:
+		args ( [this] { return oRole(); } );
+		return Kernel.disjointORoles();
+	case ascDisjointDRoles:
+		args ( [this] { return dRole(); } );
+		return Kernel.disjointDRoles();
+	case ascORoleDomain:
+	{
+		TORoleExpr* R = oRole();
+		return Kernel.setODomain ( R, concept() );
+	}
+	case ascDRoleDomain:
+	{
+		TDRoleExpr* A = dRole();
+		return Kernel.setDDomain ( A, concept() );
+	}
+	case ascORoleRange:
+	{
+		TORoleExpr* R = oRole();
+		return Kernel.setORange ( R, concept() );
+	}
+	case ascDRoleRange:
+	{
+		TDRoleExpr* A = dRole();
+		return Kernel.setDRange ( A, data() );
+	}
+	case ascTransitive:
+		return Kernel.setTransitive(oRole());
+	case ascReflexive:
+		return Kernel.setReflexive(oRole());
+	case ascIrreflexive:
+		return Kernel.setIrreflexive(oRole());
+	case ascSymmetric:
+		return Kernel.setSymmetric(oRole());
+	case ascAsymmetric:
+		return Kernel.setAsymmetric(oRole());
+	case ascOFunctional:
+		return Kernel.setOFunctional(oRole());
+	case ascDFunctional:
+		return Kernel.setDFunctional(dRole());
+	case ascInverseFunctional:
+		return Kernel.setInverseFunctional(oRole());
+	case ascInstanceOf:
+	{
+		TIndividualExpr* I = individual();
+		return Kernel.instanceOf ( I, concept() );
+	}
+	case ascRelatedTo:
+	{
+		TIndividualExpr* I = individual();
+		TORoleExpr* R = oRole();
+		return Kernel.relatedTo ( I, R, individual() );
+	}
+	case ascRelatedToNot:
+	{
+		TIndividualExpr* I = individual();
+		TORoleExpr* R = oRole();
+		return Kernel.relatedToNot ( I, R, individual() );
+	}
+	case ascValueOf:
+	{
+		TIndividualExpr* I = individual();
+		TDRoleExpr* A = dRole();
+		return Kernel.valueOf ( I, A, dataValue() );
+	}
+	case ascValueOfNot:
+	{
+		TIndividualExpr* I = individual();
+		TDRoleExpr* A = dRole();
+		return Kernel.valueOfNot ( I, A, dataValue() );
+	}
+	case ascSameIndividuals:
+		args ( [this] { return individual(); } );
+		return Kernel.processSame();
+	case ascDifferentIndividuals:
+		args ( [this] { return individual(); } );
+		return Kernel.processDifferent();
+	default:
+		error("axiom expected");
+	}
+}
+
+/// add all the axioms from the axiom stream CODES with the names NAMES to the ontology; put them into AXIOMS
+void
+ReasoningKernel :: loadAxiomStream ( const int* codes, size_t nCodes, const std::vector<const char*>& Names, AxiomVec& Axioms )
+{
+	AxiomStreamReader Reader ( *this, codes, nCodes, Names );
+	Reader.load(Axioms);
+}
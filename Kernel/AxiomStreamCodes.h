@@ -0,0 +1,126 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef AXIOMSTREAMCODES_H
+#define AXIOMSTREAMCODES_H
+
+/*
+ * Codes of the axiom stream, the compact serialised form of an ontology for the bulk loading.
+ * The stream is an array of ints that contains axioms one after another. Every axiom and every
+ * expression is written in prefix form: its code followed by its arguments as listed below.
+ * N is the number of the following arguments, M is a cardinality and K is an index in the array of names.
+ * C, I, R (S), A (B), E, T, V and F stand for concept, individual, object role, data role, data, data type,
+ * data value and facet expressions respectively.
+ * The C interface (fact.h) includes this header, so keep it C-compatible. The Java interface carries
+ * a copy of these codes (AxiomStreamCodes.java), so keep them in sync.
+ */
+
+enum AxiomStreamCode
+{
+	/* axioms */
+
+	ascDeclaration = 1,			/* any expression */
+	ascConceptInclusion,		/* C D */
+	ascEquivalentConcepts,		/* N C1 ... Cn */
+	ascDisjointConcepts,		/* N C1 ... Cn */
+	ascDisjointUnion,			/* C N C1 ... Cn */
+	ascInverseRoles,			/* R S */
+	ascORoleInclusion,			/* R(complex) S */
+	ascDRoleInclusion,			/* A B */
+	ascEquivalentORoles,		/* N R1 ... Rn */
+	ascEquivalentDRoles,		/* N A1 ... An */
+	ascDisjointORoles,			/* N R1 ... Rn */
+	ascDisjointDRoles,			/* N A1 ... An */
+	ascORoleDomain,				/* R C */
+	ascDRoleDomain,				/* A C */
+	ascORoleRange,				/* R C */
+	ascDRoleRange,				/* A E */
+	ascTransitive,				/* R */
+	ascReflexive,				/* R */
+	ascIrreflexive,				/* R */
+	ascSymmetric,				/* R */
+	ascAsymmetric,				/* R */
+	ascOFunctional,				/* R */
+	ascDFunctional,				/* A */
+	ascInverseFunctional,		/* R */
+	ascInstanceOf,				/* I C */
+	ascRelatedTo,				/* I R J */
+	ascRelatedToNot,			/* I R J */
+	ascValueOf,					/* I A V */
+	ascValueOfNot,				/* I A V */
+	ascSameIndividuals,			/* N I1 ... In */
+	ascDifferentIndividuals,	/* N I1 ... In */
+
+	/* concept expressions */
+
+	ascConceptName = 64,		/* K */
+	ascConceptTop,
+	ascConceptBottom,
+	ascConceptNot,				/* C */
+	ascConceptAnd,				/* N C1 ... Cn */
+	ascConceptOr,				/* N C1 ... Cn */
+	ascConceptOneOf,			/* N I1 ... In */
+	ascObjectSelf,				/* R */
+	ascObjectValue,				/* R I */
+	ascObjectExists,			/* R C */
+	ascObjectForall,			/* R C */
+	ascObjectMinCardinality,	/* M R C */
+	ascObjectMaxCardinality,	/* M R C */
+	ascObjectCardinality,		/* M R C */
+	ascDataValueRestriction,	/* A V */
+	ascDataExists,				/* A E */
+	ascDataForall,				/* A E */
+	ascDataMinCardinality,		/* M A E */
+	ascDataMaxCardinality,		/* M A E */
+	ascDataCardinality,			/* M A E */
+
+	/* individual expressions */
+
+	ascIndividualName = 96,		/* K */
+
+	/* role expressions */
+
+	ascObjectRoleName = 112,	/* K */
+	ascObjectRoleTop,
+	ascObjectRoleBottom,
+	ascObjectRoleInverse,		/* R */
+	ascObjectRoleChain,			/* N R1 ... Rn */
+	ascObjectRoleProjectFrom,	/* R C */
+	ascObjectRoleProjectInto,	/* R C */
+	ascDataRoleName,			/* K */
+	ascDataRoleTop,
+	ascDataRoleBottom,
+
+	/* data expressions */
+
+	ascDataTop = 128,
+	ascDataBottom,
+	ascDataTypeName,			/* K */
+	ascDataTypeRestriction,		/* T N F1 ... Fn */
+	ascDataValue,				/* K T: value given by the name K of the type T */
+	ascDataNot,					/* E */
+	ascDataAnd,					/* N E1 ... En */
+	ascDataOr,					/* N E1 ... En */
+	ascDataOneOf,				/* N V1 ... Vn */
+	ascFacetMinInclusive,		/* V */
+	ascFacetMinExclusive,		/* V */
+	ascFacetMaxInclusive,		/* V */
+	ascFacetMaxExclusive		/* V */
+};
+
+#endif
@@ -249,15 +249,11 @@ DlCompletionTree :: B2Complex ( const RAStateTransitions& RST, BipolarPointer C
 		if ( !RST.recognise(R) )
 			continue;
 
-		for ( const auto& trans: RST )
-			if ( trans.applicable(R) )
+		for ( RAStateTransitions::succ_iterator q = RST.succ_begin(R->getIndex()), q_end = RST.succ_end(R->getIndex()); q != q_end; ++q )
+			if ( !parLab.containsCC ( C + (BipolarPointer)*q ) )
 			{
-				BipolarPointer bpFinal = C + (BipolarPointer) trans.final();
-				if ( !parLab.containsCC(bpFinal) )
-				{
-					FAIL_B(2);
-					return false;
-				}
+				FAIL_B(2);
+				return false;
 			}
 	}
 
@@ -254,6 +254,30 @@ TBox :: and2dag ( const DLTree* t )
 	return ret;
 }
 
+BipolarPointer TBox :: and2dag ( BipolarPointer p, BipolarPointer q )
+{
+	DLVertex* v = new DLVertex(dtAnd);
+
+	if ( v->addChild(p) || v->addChild(q) )	// clash found
+	{
+		delete v;
+		return bpBOTTOM;
+	}
+
+	switch ( v->end() - v->begin() )
+	{
+	case 0:	// and(TOP,TOP) = TOP
+		delete v;
+		return bpTOP;
+	case 1:	// and(C,TOP) = C
+		p = *v->begin();
+		delete v;
+		return p;
+	default:
+		return DLHeap.add(v);
+	}
+}
+
 BipolarPointer TBox :: forall2dag ( const TRole* R, BipolarPointer C )
 {
 	if ( R->isDataRole() )
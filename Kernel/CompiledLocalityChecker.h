@@ -0,0 +1,265 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2011-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef COMPILEDLOCALITYCHECKER_H
+#define COMPILEDLOCALITYCHECKER_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "SyntacticLocalityChecker.h"
+#include "ExtendedSyntacticLocalityChecker.h"
+
+/// syntactic locality checker that evaluates axioms using their compiled form.
+/// The syntactic locality of an axiom (both the standard and the counting one) depends only on which of its
+/// concept and role names are in the signature. For every axiom with a small signature this function is compiled
+/// by the BaseChecker into a decision diagram: a flat array of nodes, each of them checks whether a name is in the
+/// signature and jumps to the next node.
+template<class BaseChecker>
+class TCompiledLocalityChecker: public BaseChecker
+{
+protected:	// types
+		/// node of a decision diagram
+	struct DDNode
+	{
+			/// entity to check
+		const TNamedEntity* Entity;
+			/// id of the entity
+		unsigned int id;
+			/// next node if the entity is not in the signature
+		int lo;
+			/// next node if the entity is in the signature
+		int hi;
+	};
+		/// compiled form of an axiom
+	struct CompiledAxiom
+	{
+			/// axiom the form was compiled from; NULL for an empty record
+		const TDLAxiom* Axiom = nullptr;
+			/// root nodes for BOT- and TOP-locality
+		int Root[2] = { ddFalse, ddFalse };
+			/// true iff the axiom has too many names to be compiled
+		bool tooLarge = false;
+	};
+
+protected:	// members
+		/// compiled axioms indexed by the axiom id
+	std::vector<CompiledAxiom> Compiled;
+		/// nodes of all decision diagrams
+	std::vector<DDNode> Nodes;
+		/// all the entities that appear in compiled axioms
+	std::vector<const TNamedEntity*> Entities;
+		/// map between entities and their ids
+	std::unordered_map<const TNamedEntity*, unsigned int> EntityIds;
+		/// signature used to build truth tables
+	TSignature compileSig;
+		/// checker to build truth tables
+	BaseChecker Compiler;
+		/// membership of all the entities in the signature; used in bulk evaluation
+	std::vector<bool> InSig;
+
+		/// terminal node for non-local result
+	static constexpr int ddFalse = -1;
+		/// terminal node for local result
+	static constexpr int ddTrue = -2;
+		/// max number of names in the compiled axiom
+	static constexpr unsigned int maxArgs = 6;
+
+protected:	// methods
+		/// @return id of an ENTITY; register it if necessary
+	unsigned int getEntityId ( const TNamedEntity* entity )
+	{
+		auto p = EntityIds.find(entity);
+		if ( p != EntityIds.end() )
+			return p->second;
+		unsigned int id = (unsigned int)Entities.size();
+		Entities.push_back(entity);
+		EntityIds[entity] = id;
+		return id;
+	}
+		/// @return terminal node if TABLE has the same value for all indices that has VAL on the bits from MASK; @return 0 otherwise
+	static int getConst ( unsigned long long table, unsigned int size, unsigned int mask, unsigned int val )
+	{
+		bool seenTrue = false, seenFalse = false;
+		for ( unsigned int i = 0; i < size; ++i )
+			if ( (i & mask) == val )
+				( (table >> i) & 1 ? seenTrue : seenFalse ) = true;
+		if ( !seenFalse )
+			return ddTrue;
+		if ( !seenTrue )
+			return ddFalse;
+		return 0;
+	}
+		/// build decision diagram for TABLE over ARGS restricted by VAL on the bits from MASK; @return its root
+	int buildDD ( const std::vector<unsigned int>& Args, unsigned long long table, unsigned int mask, unsigned int val )
+	{
+		unsigned int size = 1U << Args.size();
+		if ( int leaf = getConst ( table, size, mask, val ) )
+			return leaf;
+		// prefer the name that defines the result in one of the branches
+		unsigned int best = Args.size();
+		for ( unsigned int j = 0; j < Args.size(); ++j )
+		{
+			unsigned int bit = 1U << j;
+			if ( mask & bit )
+				continue;
+			if ( best == Args.size() )
+				best = j;
+			if ( getConst ( table, size, mask|bit, val ) || getConst ( table, size, mask|bit, val|bit ) )
+			{
+				best = j;
+				break;
+			}
+		}
+		unsigned int bit = 1U << best;
+		int node = (int)Nodes.size();
+		Nodes.push_back ( { Entities[Args[best]], Args[best], ddFalse, ddFalse } );
+		int lo = buildDD ( Args, table, mask|bit, val );
+		int hi = buildDD ( Args, table, mask|bit, val|bit );
+		Nodes[node].lo = lo;
+		Nodes[node].hi = hi;
+		return node;
+	}
+		/// build a compiled form C of an AXIOM
+	void compile ( const TDLAxiom* axiom, CompiledAxiom& C )
+	{
+		C.Axiom = axiom;
+		std::vector<unsigned int> Args;
+		// individuals do not affect syntactic locality
+		for ( const TNamedEntity* entity : const_cast<TDLAxiom*>(axiom)->getSignature() )
+			if ( dynamic_cast<const TDLIndividualName*>(entity) == nullptr )
+				Args.push_back(getEntityId(entity));
+		C.tooLarge = Args.size() > maxArgs;
+		if ( C.tooLarge )
+			return;
+		// bit I of the truth table is the locality value wrt the signature with all Args[j] for bits j set in I
+		unsigned int size = 1U << Args.size();
+		for ( unsigned int top = 0; top < 2; ++top )
+		{
+			unsigned long long table = 0;
+			for ( unsigned int i = 0; i < size; ++i )
+			{
+				compileSig.clear();
+				compileSig.setLocality(top == 1);
+				for ( unsigned int j = 0; j < Args.size(); ++j )
+					if ( i & (1U << j) )
+						compileSig.add(Entities[Args[j]]);
+				if ( Compiler.local(axiom) )
+					table |= 1ULL << i;
+			}
+			C.Root[top] = buildDD ( Args, table, 0, 0 );
+		}
+	}
+		/// @return compiled form of an AXIOM; @return NULL if the axiom can't be compiled
+	const CompiledAxiom* getCompiled ( const TDLAxiom* axiom )
+	{
+		unsigned int id = axiom->getId();
+		if ( unlikely(id == 0) )	// not in the ontology
+			return nullptr;
+		if ( id > Compiled.size() )
+			Compiled.resize(id);
+		CompiledAxiom& C = Compiled[id-1];
+		if ( unlikely(C.Axiom != axiom) )
+			compile ( axiom, C );
+		return C.tooLarge ? nullptr : &C;
+	}
+		/// @return locality of C wrt the current signature
+	bool evaluate ( const CompiledAxiom& C ) const
+	{
+		int node = C.Root[this->topCLocal()];
+		while ( node >= 0 )
+		{
+			const DDNode& N = Nodes[node];
+			node = this->nc(N.Entity) ? N.lo : N.hi;
+		}
+		return node == ddTrue;
+	}
+		/// @return locality of C wrt the pre-computed membership vector
+	bool evaluateInSig ( const CompiledAxiom& C ) const
+	{
+		int node = C.Root[this->topCLocal()];
+		while ( node >= 0 )
+		{
+			const DDNode& N = Nodes[node];
+			node = InSig[N.id] ? N.hi : N.lo;
+		}
+		return node == ddTrue;
+	}
+
+public:		// interface
+		/// init c'tor
+	explicit TCompiledLocalityChecker ( const TSignature* s )
+		: BaseChecker(s)
+		, Compiler(&compileSig)
+		{}
+
+		/// compile all the axioms of an ontology
+	void preprocessOntology ( const AxiomVec& Axioms ) override
+	{
+		for ( TDLAxiom* axiom : Axioms )
+			getCompiled(axiom);
+	}
+		/// @return true iff an AXIOM is local wrt signature
+	bool local ( const TDLAxiom* axiom ) override
+	{
+		// diagrams are built for the same locality of concepts and roles
+		if ( likely(this->topCLocal() == this->topRLocal()) )
+			if ( const CompiledAxiom* C = getCompiled(axiom) )
+				return evaluate(*C);
+		return BaseChecker::local(axiom);
+	}
+		/// fill LOCAL with the locality values of all AXIOMS wrt signature
+	void local ( const AxiomVec& Axioms, std::vector<bool>& Local ) override
+	{
+		if ( unlikely(this->topCLocal() != this->topRLocal()) )
+		{
+			BaseChecker::local ( Axioms, Local );
+			return;
+		}
+		for ( TDLAxiom* axiom : Axioms )
+			getCompiled(axiom);
+		// check every entity only once
+		InSig.assign ( Entities.size(), false );
+		if ( this->getSignature()->size() < Entities.size() )
+		{
+			for ( const TNamedEntity* entity : *this->getSignature() )
+			{
+				auto p = EntityIds.find(entity);
+				if ( p != EntityIds.end() )
+					InSig[p->second] = true;
+			}
+		}
+		else
+			for ( unsigned int i = 0; i < Entities.size(); ++i )
+				InSig[i] = !this->nc(Entities[i]);
+		Local.resize(Axioms.size());
+		for ( size_t i = 0; i < Axioms.size(); ++i )
+		{
+			const CompiledAxiom* C = getCompiled(Axioms[i]);
+			Local[i] = C ? evaluateInSig(*C) : BaseChecker::local(Axioms[i]);
+		}
+	}
+}; // TCompiledLocalityChecker
+
+/// compiled checker for the standard syntactic locality
+typedef TCompiledLocalityChecker<SyntacticLocalityChecker> CompiledLocalityChecker;
+/// compiled checker for the counting syntactic locality
+typedef TCompiledLocalityChecker<ExtendedSyntacticLocalityChecker> CompiledExtendedLocalityChecker;
+
+#endif
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 \*******************************************************/
 
 #include <queue>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -34,7 +35,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 |* 			Implementation of class Taxonomy			*|
 \********************************************************/
 
-bool DLConceptTaxonomy :: testSub ( const TConcept* p, const TConcept* q )
+bool DLConceptTaxonomy :: testSub ( const TConcept* p, const TConcept* q, enum modelCacheState cached )
 {
 	fpp_assert ( p != nullptr );
 	fpp_assert ( q != nullptr );
@@ -66,7 +67,10 @@ bool DLConceptTaxonomy :: testSub ( const TConcept* p, const TConcept* q )
 		return false;
 	}
 
-	switch ( tBox.testCachedNonSubsumption ( p, q ) )
+	if ( cached == csUnknown )
+		cached = tBox.testCachedNonSubsumption ( p, q );
+
+	switch ( cached )
 	{
 	case csValid:	// cached result: satisfiable => non-subsumption
 		if ( LLM.isWritable(llTaxTrying) )
@@ -139,10 +143,80 @@ void DLConceptTaxonomy :: print ( std::ostream& o ) const
 	o << "There were made " << nSearchCalls << " search calls\nThere were made " << nSubCalls
 	  << " Sub calls, of which " << nNonTrivialSubCalls << " non-trivial\n";
 	o << "Current efficiency (wrt Brute-force) is " << nEntries*(nEntries-1)/n << "\n";
+	printPhaseStatistic(o);
 
 	TaxonomyCreator::print(o);
 }
 
+void DLConceptTaxonomy :: printPhaseStatistic ( std::ostream& o ) const
+{
+	o << "Top-Down phase: " << nTopDownTries << " subsumption tests in " << topDownTimer
+	  << " seconds\nBottom-Up phase: " << nBottomUpTries << " subsumption tests in " << bottomUpTimer
+	  << " seconds; " << nBottomUpCachedNegative << " candidates were rejected by the cached ~C model\n";
+	if ( nBatchedIndividuals )
+		o << "Individual batching classified " << nBatchedIndividuals << " individuals without tests\n";
+}
+
+void
+DLConceptTaxonomy :: setBatchIndividuals ( bool use )
+{
+	flagBatchIndividuals = use;
+	IndRepresentatives.clear();
+	NonBatchable.clear();
+	if ( !use )
+		return;
+
+	// individuals from DIFFERENT and SAME-AS are not interchangeable with others
+	for ( const auto& diff: tBox.Different )
+		NonBatchable.insert ( diff.begin(), diff.end() );
+	for ( const auto& same: tBox.SameI )
+	{
+		NonBatchable.insert(static_cast<const TIndividual*>(same.first));
+		NonBatchable.insert(same.second.first);
+	}
+}
+
+bool
+DLConceptTaxonomy :: classifyAsBatched ( void )
+{
+	const TConcept* C = curConcept();
+	// only individuals that are not mentioned in the TBox could be swapped with each other in every model
+	if ( !C->isSingleton() || C->isNominal() || !C->isPrimitive() || pTax->queryMode() )
+		return false;
+	const TIndividual* ind = static_cast<const TIndividual*>(C);
+	if ( NonBatchable.count(ind) > 0 )
+		return false;
+
+	IndividualKey key;
+	key.first = ind->pBody;
+	for ( const TRelated* rel: ind->RelatedIndex )
+		key.second.push_back(std::make_pair(rel->getRole(),rel->b));
+	std::sort ( key.second.begin(), key.second.end() );
+
+	auto found = IndRepresentatives.find(key);
+	if ( found == IndRepresentatives.end() )
+	{	// the first individual with such a key: classify it as usual
+		IndRepresentatives[key] = ind;
+		return false;
+	}
+
+	TaxonomyVertex* rep = found->second->getTaxVertex();
+	if ( rep == nullptr || rep->getPrimer() != found->second || rep == pTax->getBottomVertex() )
+		return false;
+
+	// individuals have no sub-concepts, so the types of the representative are all we need
+	TaxonomyVertex* cur = pTax->getCurrent();
+	for ( TaxonomyVertex::iterator p = rep->begin(/*upDirection=*/true), p_end = rep->end(/*upDirection=*/true); p != p_end; ++p )
+		cur->addNeighbour ( /*upDirection=*/true, *p );
+	pTax->finishCurrentNode();
+
+	if ( LLM.isWritable(llTaxTrying) )
+		LL << "\nTAX: individual '" << C->getName() << "' has the same types as '" << found->second->getName() << "'";
+
+	++nBatchedIndividuals;
+	return true;
+}
+
 // Baader procedures
 void
 DLConceptTaxonomy :: searchBaader ( TaxonomyVertex* cur )
@@ -173,7 +247,7 @@ DLConceptTaxonomy :: searchBaader ( TaxonomyVertex* cur )
 }
 
 bool
-DLConceptTaxonomy :: enhancedSubs1 ( TaxonomyVertex* cur )
+DLConceptTaxonomy :: enhancedSubs1 ( TaxonomyVertex* cur, enum modelCacheState cached )
 {
 	++nNonTrivialSubCalls;
 
@@ -184,15 +258,37 @@ DLConceptTaxonomy :: enhancedSubs1 ( TaxonomyVertex* cur )
 			return false;
 
 	// all subsumptions holds -- test current for subsumption
-	return testSubsumption(cur);
+	return testSubsumption ( cur, cached );
+}
+
+enum modelCacheState
+DLConceptTaxonomy :: testCachedNonSubsumer ( TaxonomyVertex* cur )
+{
+	const TConcept* testC = static_cast<const TConcept*>(cur->getPrimer());
+	const TConcept* C = curConcept();
+
+	// the same pre-conditions as in testSub()
+	if ( C->isSingleton() && C->isPrimitive() && !C->isNominal() )
+		return csUnknown;
+	// ~C cache is built once for C and is kept in the DAG; the model of TESTC was built during its SAT test
+	enum modelCacheState cached = tBox.testCachedNonSubsumption ( testC, C );
+	if ( cached != csValid )
+		return cached;
+
+	if ( LLM.isWritable(llTaxTrying) )
+		LL << "\nTAX: trying '" << testC->getName() << "' [= '" << C->getName() << "'... NOT holds (cached BU result)";
+
+	++nCachedNegative;
+	++nBottomUpCachedNegative;
+	return csValid;
 }
 
 bool
-DLConceptTaxonomy :: testSubsumption ( TaxonomyVertex* cur )
+DLConceptTaxonomy :: testSubsumption ( TaxonomyVertex* cur, enum modelCacheState cached )
 {
 	const TConcept* testC = static_cast<const TConcept*>(cur->getPrimer());
 	if ( upDirection )
-		return testSub ( testC, curConcept() );
+		return testSub ( testC, curConcept(), cached );
 	else
 		return testSub ( curConcept(), testC );
 }
@@ -351,13 +447,15 @@ DLConceptTaxonomy :: reclassify ( const std::set<const TNamedEntity*>& plus, con
 	{
 		TaxonomyVertex* node = entry->getTaxVertex();
 		const TNamedEntity* entity = entry->getEntity();
-		std::cout << "Reclassify " << entity->getName() << " (" << (MPlus.count(entity) > 0 ?"Added":"") << (MMinus.count(entity) > 0 ?" Removed":"") << ")";
+		if ( LLM.isWritable(llAlways) )
+			LL << "\nReclassify " << entity->getName() << " (" << (MPlus.count(entity) > 0 ?"Added":"") << (MMinus.count(entity) > 0 ?" Removed":"") << ")";
 
 		TsProcTimer timer;
 		timer.Start();
 		reclassify ( node, (*tBox.pName2Sig)[entity] );
 		timer.Stop();
-		std::cout << "; reclassification time: " << timer << std::endl;
+		if ( LLM.isWritable(llAlways) )
+			LL << "; reclassification time: " << timer << " seconds";
 //		tax->print(std::cout);
 //		std::cout.flush();
 	}
@@ -445,6 +543,12 @@ void TBox :: createTaxonomy ( bool needIndividual )
 	// if there were SAT queries before -- the query (or other) concepts are there. Delete it
 	clearQueryConcept();
 
+	// taxonomy is going to change, so the instances are to be re-indexed
+	delete pInstIndex;
+	pInstIndex = nullptr;
+	delete pDataIndex;
+	pDataIndex = nullptr;
+
 	// here we sure that ontology is consistent
 	// FIXME!! distinguish later between the 1st run and the following runs
 	if ( pTax == nullptr )	// 1st run
@@ -452,6 +556,8 @@ void TBox :: createTaxonomy ( bool needIndividual )
 
 	DLHeap.setSubOrder();	// init priorities in order to do subsumption tests
 	pTaxCreator->setBottomUp(GCIs);
+	pTaxCreator->setCachedBottomUp(useCachedBottomUp);
+	pTaxCreator->setBatchIndividuals(useIndividualBatching);
 	needConcept |= needIndividual;	// together with concepts
 //	else	// not a first run
 //		return;	// FIXME!! now we don't perform staged reasoning, so everything is done
@@ -509,7 +615,10 @@ void TBox :: createTaxonomy ( bool needIndividual )
 	if ( needConcept && Status < kbClassified )
 		Status = kbClassified;
 	if ( needIndividual )
+	{
 		Status = kbRealised;
+		buildDataValueIndex();
+	}
 
 	if ( verboseOutput/* && needIndividual*/ )
 	{
@@ -23,6 +23,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "TaxonomyCreator.h"
 #include "dlTBox.h"
 #include "tProgressMonitor.h"
+#include "procTimer.h"
+#include "InstanceIndex.h"
 
 /// Taxonomy of named DL concepts (and mapped individuals)
 class DLConceptTaxonomy: public TaxonomyCreator
@@ -62,9 +64,18 @@ protected:	// types
 		ss_iterator p_end ( void ) override { return Possible.end(); }
 	}; // DerivedSubsumers
 
+		/// neighbourhood of an individual: sorted pairs <R,b> for every R(a,b) (including inverse ones)
+	typedef std::vector<std::pair<const TRole*, const TIndividual*> > IndNeighbourhood;
+		/// key of an individual: its body together with its neighbourhood
+	typedef std::pair<BipolarPointer, IndNeighbourhood> IndividualKey;
+
 protected:	// members
 		/// host tBox
 	TBox& tBox;
+		/// classified individuals by their keys; two individuals with the same key have the same types
+	std::map<IndividualKey, const TIndividual*> IndRepresentatives;
+		/// individuals that are not interchangeable with others because of same-as or different axioms
+	std::set<const TIndividual*> NonBatchable;
 		/// incremental sets M+ and M-
 	std::set<const TNamedEntity*> MPlus, MMinus;
 		/// set of possible parents
@@ -94,6 +105,21 @@ protected:	// members
 		/// number of non-subsumptions because of module reasons
 	unsigned long nModuleNegative = 0;
 
+	// per-phase statistic
+
+		/// number of tableau subsumption tests made during TD phase
+	unsigned long nTopDownTries = 0;
+		/// number of tableau subsumption tests made during BU phase
+	unsigned long nBottomUpTries = 0;
+		/// number of BU candidates rejected by a cache merge before exploring their descendants
+	unsigned long nBottomUpCachedNegative = 0;
+		/// number of individuals classified by copying the parents of their representatives
+	unsigned long nBatchedIndividuals = 0;
+		/// timer for the TD phase
+	TsProcTimer topDownTimer;
+		/// timer for the BU phase
+	TsProcTimer bottomUpTimer;
+
 		/// indicator of taxonomy creation progress
 	TProgressMonitor* pTaxProgress = nullptr;
 
@@ -101,6 +127,10 @@ protected:	// members
 
 		/// flag to use Bottom-Up search
 	bool flagNeedBottomUp = false;
+		/// flag to pre-check BU candidates by merging their cached models with the cache of ~C
+	bool flagCachedBottomUp = true;
+		/// flag to classify individuals with the same key as a single one
+	bool flagBatchIndividuals = true;
 
 protected:	// methods
 	//-----------------------------------------------------------------
@@ -110,7 +140,8 @@ protected:	// methods
 		/// get access to curEntry as a TConcept
 	const TConcept* curConcept ( void ) const { return static_cast<const TConcept*>(curEntry); }
 		/// tests subsumption (via tBox) and gather statistics.  Use cache and other optimisations.
-	bool testSub ( const TConcept* p, const TConcept* q );
+		/// CACHED is the result of the cache merging if it was already done for P and Q
+	bool testSub ( const TConcept* p, const TConcept* q, enum modelCacheState cached = csUnknown );
 		/// test subsumption via TBox explicitly
 	bool testSubTBox ( const TConcept* p, const TConcept* q )
 	{
@@ -118,6 +149,10 @@ protected:	// methods
 
 		// update statistic
 		++nTries;
+		if ( upDirection )
+			++nBottomUpTries;
+		else
+			++nTopDownTries;
 
 		if ( res )
 			++nPositives;
@@ -132,7 +167,7 @@ protected:	// methods
 		/// SEARCH procedure from Baader et al paper
 	void searchBaader ( TaxonomyVertex* cur );
 		/// ENHANCED_SUBS procedure from Baader et al paper
-	bool enhancedSubs1 ( TaxonomyVertex* cur );
+	bool enhancedSubs1 ( TaxonomyVertex* cur, enum modelCacheState cached = csUnknown );
 		/// short-cut from ENHANCED_SUBS
 	bool enhancedSubs2 ( TaxonomyVertex* cur )
 	{
@@ -141,6 +176,15 @@ protected:	// methods
 			return false;
 		if ( unlikely ( useCandidates && candidates.find(cur) == candidates.end() ) )
 			return false;
+		// cheap cache-based rejection of a BU candidate saves checking all its descendants
+		if ( upDirection && flagCachedBottomUp )
+		{
+			enum modelCacheState cached = testCachedNonSubsumer(cur);
+			if ( cached == csValid )
+				return false;
+			// don't merge the same caches again when testing CUR itself
+			return enhancedSubs1 ( cur, cached );
+		}
 		return enhancedSubs1(cur);
 	}
 		// wrapper for the ENHANCED_SUBS
@@ -153,8 +197,10 @@ protected:	// methods
 		else
 			return setValue ( cur, enhancedSubs2(cur) );
 	}
-		/// explicitly test appropriate subsumption relation
-	bool testSubsumption ( TaxonomyVertex* cur );
+		/// explicitly test appropriate subsumption relation; CACHED is the known result of the cache merging
+	bool testSubsumption ( TaxonomyVertex* cur, enum modelCacheState cached = csUnknown );
+		/// @return the result of merging the model of CUR with the cached model of ~curConcept; csUnknown if not merged
+	enum modelCacheState testCachedNonSubsumer ( TaxonomyVertex* cur );
 		/// test whether a node could be a super-node of CUR
 	bool possibleSub ( TaxonomyVertex* v ) const
 	{
@@ -186,6 +232,10 @@ protected:	// methods
 		/// fill candidates
 	void fillCandidates ( TaxonomyVertex* cur );
 
+		/// @return true iff the current entry is an individual with the same key as an already classified one;
+		/// in that case the entry is inserted into the taxonomy with the representative's parents
+	bool classifyAsBatched ( void );
+
 	//-----------------------------------------------------------------
 	//--	Tunable methods (depending on taxonomy type)
 	//-----------------------------------------------------------------
@@ -203,7 +253,12 @@ protected:	// methods
 	bool needTopDown ( void ) const override
 		{ return !(useCompletelyDefined && curEntry->isCompletelyDefined ()); }
 		/// explicitly run TD phase
-	void runTopDown ( void ) override { searchBaader(pTax->getTopVertex()); }
+	void runTopDown ( void ) override
+	{
+		topDownTimer.Start();
+		searchBaader(pTax->getTopVertex());
+		topDownTimer.Stop();
+	}
 		/// check if it is possible to skip BU phase
 	bool needBottomUp ( void ) const override
 	{
@@ -214,6 +269,13 @@ protected:	// methods
 	}
 		/// explicitly run BU phase
 	void runBottomUp ( void ) override
+	{
+		bottomUpTimer.Start();
+		runBottomUpSearch();
+		bottomUpTimer.Stop();
+	}
+		/// BU search itself: find all the maximal subsumees of the current concept
+	void runBottomUpSearch ( void )
 	{
 		if ( propagateUp() )	// Common is set up here
 			return;
@@ -253,12 +315,18 @@ public:		// interface
 
 		/// set bottom-up flag
 	void setBottomUp ( const TKBFlags& GCIs ) { flagNeedBottomUp = (GCIs.isGCI() || (GCIs.isReflexive() && GCIs.isRnD())); }
+		/// set the cached BU pre-check flag
+	void setCachedBottomUp ( bool use ) { flagCachedBottomUp = use; }
+		/// set up individual batching; clear all the representatives
+	void setBatchIndividuals ( bool use );
 		/// reclassify taxonomy wrt changed sets
 	void reclassify ( const std::set<const TNamedEntity*>& MPlus, const std::set<const TNamedEntity*>& MMinus );
 		/// set progress indicator
 	void setProgressIndicator ( TProgressMonitor* pMon ) { pTaxProgress = pMon; }
 		/// output taxonomy to a stream
 	void print ( std::ostream& o ) const override;
+		/// output per-phase timings and test numbers to a stream
+	void printPhaseStatistic ( std::ostream& o ) const;
 }; // DLConceptTaxonomy
 
 //
@@ -281,6 +349,10 @@ inline bool DLConceptTaxonomy :: immediatelyClassified ( void )
 	if ( classifySynonym() )
 		return true;
 
+	// individuals indistinguishable from already classified ones are not tested at all
+	if ( flagBatchIndividuals && classifyAsBatched() )
+		return true;
+
 	if ( curConcept()->getClassTag() == cttTrueCompletelyDefined )
 		return false;	// true CD concepts can not be unsat
 
@@ -298,6 +370,7 @@ inline void
 TBox :: initTaxonomy ( void )
 {
 	pTax = new Taxonomy ( pTop, pBottom );
+	pTax->setUseIndex(useTaxonomyIndex);
 	pTaxCreator = new DLConceptTaxonomy ( pTax, *this );
 }
 
@@ -313,8 +386,12 @@ TBox :: classifyEntry ( TConcept* entry )
 inline void
 TBox :: reclassify ( const std::set<const TNamedEntity*>& MPlus, const std::set<const TNamedEntity*>& MMinus )
 {
+	// instances might change
+	delete pInstIndex;
+	pInstIndex = nullptr;
 	pTaxCreator->reclassify ( MPlus, MMinus );
 	Status = kbRealised;	// FIXME!! check whether it is classified/realised
+	buildDataValueIndex();
 }
 
 #endif // DLCONCEPTTAXONOMY_H
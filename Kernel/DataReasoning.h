@@ -21,7 +21,6 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define DATAREASONING_H
 
 
-#include <map>
 #include <vector>
 
 #include "tDataEntry.h"
@@ -198,14 +197,12 @@ class DataTypeReasoner
 protected:	// types
 		/// vector of data types
 	typedef std::vector<DataTypeAppearance*> DTAVector;
-		/// map from positive BPs (DT pNames) to corresponding data type
-	typedef std::map<const TDataEntry*,size_t> TypeMap;
 
 protected:	// members
 		/// vector of a types
 	DTAVector Types;
-		/// map Type.pName->Type appearance
-	TypeMap Map;
+		/// type appearances indexed by the type index of the data type
+	DTAVector TypeByIndex;
 		/// external DAG
 	const DLDag& DLHeap;
 		/// type that has pos-entry
@@ -249,10 +246,14 @@ protected:	// methods
 		/// get DTA by given data-type pointer
 	DataTypeAppearance* getDTAbyType ( const TDataEntry* dataType )
 	{
-#	ifdef ENABLE_CHECKING
-		fpp_assert ( Map.find(dataType) != Map.end() );
-#	endif
-		return Types[Map[dataType]];
+		unsigned int index = dataType->getTypeIndex();
+		// the type might not be registered if it doesn't appear in the DAG
+		if ( unlikely ( index >= TypeByIndex.size() || TypeByIndex[index] == nullptr ) )
+		{
+			registerDataType(dataType);
+			TypeByIndex[index]->clear();
+		}
+		return TypeByIndex[index];
 	}
 		/// get DTA by given data-value pointer
 	DataTypeAppearance* getDTAbyValue ( const TDataEntry* dataValue )
@@ -299,8 +300,10 @@ public:		// interface
 		/// add data type to the reasoner
 	void registerDataType ( const TDataEntry* p )
 	{
-		Map[p] = Types.size();
 		Types.push_back(new DataTypeAppearance(clashDep));
+		if ( p->getTypeIndex() >= TypeByIndex.size() )
+			TypeByIndex.resize ( p->getTypeIndex()+1, nullptr );
+		TypeByIndex[p->getTypeIndex()] = Types.back();
 	}
 		/// prepare types for the reasoning
 	void clear ( void )
@@ -43,7 +43,11 @@ protected:	// members
 
 protected:	// methods
 		/// register new data type
-	void RegisterDataType ( TDataType* p ) { Types.push_back(p); }
+	void RegisterDataType ( TDataType* p )
+	{
+		p->getType()->setTypeIndex((unsigned int)Types.size());
+		Types.push_back(p);
+	}
 
 	// access to datatypes
 
@@ -21,7 +21,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define DATATYPECOMPARATOR_H
 
 #include <ctime>
-#include <string>
+#include <cstring>
 #include <ostream>
 
 #include "fpp_assert.h"
@@ -31,14 +31,18 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 class ComparableDT
 {
 private:	// members
-		/// value as a string
-	std::string strValue;
-		/// value as a number
-	long longIntValue = 0;
-		/// value as a float
-	float floatValue = 0.0;
-		/// value as a date
-	long timeValue = 0;	// FIXME!! FORNOW
+		/// value of the DT; only the member that corresponds to the tag is valid
+	union
+	{
+			/// value as a number
+		long longIntValue = 0;
+			/// value as a float
+		float floatValue;
+			/// value as a date
+		long timeValue;	// FIXME!! FORNOW
+			/// value as a string; it is the name of the data value entry, so it is unique within a data type
+		const char* strValue;
+	};
 		/// tag of a value
 	enum ValueType { UNUSED = 0, INT, STR, FLOAT, TIME } vType = UNUSED;
 
@@ -50,7 +54,7 @@ public:		// interface
 		: longIntValue(value)
 		, vType(INT)
 		{}
-		/// create STRING's dt
+		/// create STRING's dt; VALUE should outlive the dt
 	explicit ComparableDT ( const char* value )
 		: strValue(value)
 		, vType(STR)
@@ -73,7 +77,7 @@ public:		// interface
 		/// get NUMBER
 	long int getLongIntValue ( void ) const { return longIntValue; }
 		/// get STRING
-	const std::string& getStringValue ( void ) const { return strValue; }
+	const char* getStringValue ( void ) const { return strValue; }
 		/// get FLOAT
 	float getFloatValue ( void ) const { return floatValue; }
 		/// get TIME
@@ -124,7 +128,7 @@ public:		// interface
 		switch ( vType )
 		{
 		case INT:	return getLongIntValue() == other.getLongIntValue();
-		case STR:	return getStringValue() == other.getStringValue();
+		case STR:	return getStringValue() == other.getStringValue() || strcmp ( getStringValue(), other.getStringValue() ) == 0;
 		case FLOAT:	return getFloatValue() == other.getFloatValue();
 		case TIME:	return getTimeValue() == other.getTimeValue();
 		default:	fpp_unreachable();
@@ -140,7 +144,7 @@ public:		// interface
 		switch ( vType )
 		{
 		case INT:	return getLongIntValue() < other.getLongIntValue();
-		case STR:	return getStringValue() < other.getStringValue();
+		case STR:	return strcmp ( getStringValue(), other.getStringValue() ) < 0;
 		case FLOAT:	return getFloatValue() < other.getFloatValue();
 		case TIME:	return getTimeValue() < other.getTimeValue();
 		default:	fpp_unreachable();
@@ -0,0 +1,113 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <algorithm>
+#include <ostream>
+
+#include "DataValueIndex.h"
+#include "tIndividual.h"
+#include "tRole.h"
+
+void
+DataValueIndex :: addValue ( const TRole* R, const TIndividual* ind, const TDataEntry* V )
+{
+	Entry entry { V, ind };
+	Values[R].push_back(entry);
+	for ( const auto& sup: R->ancestors() )
+		Values[sup].push_back(entry);
+	++nValues;
+}
+
+void
+DataValueIndex :: finalise ( void )
+{
+	auto less = [] ( const Entry& e1, const Entry& e2 )
+	{
+		if ( lessValue ( e1.Value, e2.Value ) )
+			return true;
+		if ( lessValue ( e2.Value, e1.Value ) )
+			return false;
+		return e1.Ind < e2.Ind;
+	};
+	auto equal = [] ( const Entry& e1, const Entry& e2 )
+		{ return e1.Ind == e2.Ind && !lessValue ( e1.Value, e2.Value ) && !lessValue ( e2.Value, e1.Value ); };
+
+	for ( auto& list: Values )
+	{
+		std::sort ( list.second.begin(), list.second.end(), less );
+		list.second.erase ( std::unique ( list.second.begin(), list.second.end(), equal ), list.second.end() );
+	}
+}
+
+bool
+DataValueIndex :: hasValue ( const TRole* R, const TIndividual* ind, const TDataEntry* V ) const
+{
+	ValueMap::const_iterator list = Values.find(R);
+	if ( list == Values.end() )
+		return false;
+
+	auto p = std::lower_bound ( list->second.begin(), list->second.end(), V,
+		[] ( const Entry& e, const TDataEntry* v ) { return lessValue ( e.Value, v ); } );
+	for ( auto p_end = list->second.end(); p != p_end && !lessValue ( V, p->Value ); ++p )
+		if ( p->Ind == ind )
+			return true;
+	return false;
+}
+
+void
+DataValueIndex :: getIndividuals ( const TRole* R, const TDataEntry* Min, bool minExcl, const TDataEntry* Max, bool maxExcl,
+								   IndividualVec& Result ) const
+{
+	Result.clear();
+	ValueMap::const_iterator list = Values.find(R);
+	if ( list == Values.end() )
+		return;
+
+	auto EntryLess = [] ( const Entry& e, const TDataEntry* v ) { return lessValue ( e.Value, v ); };
+	auto LessEntry = [] ( const TDataEntry* v, const Entry& e ) { return lessValue ( v, e.Value ); };
+	auto EntryLessType = [] ( const Entry& e, const TDataEntry* v ) { return lessType ( e.Value, v ); };
+	auto LessTypeEntry = [] ( const TDataEntry* v, const Entry& e ) { return lessType ( v, e.Value ); };
+
+	// an open bound is limited by the type of the other one
+	auto begin = list->second.begin(), end = list->second.end();
+	auto from = begin, to = end;
+	if ( Min != nullptr )
+		from = minExcl ? std::upper_bound ( begin, end, Min, LessEntry ) : std::lower_bound ( begin, end, Min, EntryLess );
+	else if ( Max != nullptr )
+		from = std::lower_bound ( begin, end, Max, EntryLessType );
+	if ( Max != nullptr )
+		to = maxExcl ? std::lower_bound ( from, end, Max, EntryLess ) : std::upper_bound ( from, end, Max, LessEntry );
+	else if ( Min != nullptr )
+		to = std::upper_bound ( from, end, Min, LessTypeEntry );
+
+	for ( auto p = from; p < to; ++p )
+		Result.push_back(p->Ind);
+	// an individual might have several values in the range
+	std::sort ( Result.begin(), Result.end() );
+	Result.erase ( std::unique ( Result.begin(), Result.end() ), Result.end() );
+}
+
+void
+DataValueIndex :: print ( std::ostream& o ) const
+{
+	size_t nPostings = 0;
+	for ( const auto& list: Values )
+		nPostings += list.second.size();
+	o << "Data value index: " << nValues << " values of " << Values.size() << " data roles, " << nPostings << " postings\n";
+}
@@ -0,0 +1,108 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef DATAVALUEINDEX_H
+#define DATAVALUEINDEX_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "tDataEntry.h"
+
+class TRole;
+class TIndividual;
+
+/// data role -> sorted (value, individual) lists built from the told data assertions of a realised KB.
+/// Values that are only entailed by the TBox axioms are not indexed.
+class DataValueIndex
+{
+public:		// types
+		/// vector of individuals to return
+	typedef std::vector<const TIndividual*> IndividualVec;
+		/// told data assertion R(IND,VALUE)
+	struct ToldValue
+	{
+		const TRole* R;
+		const TIndividual* Ind;
+		const TDataEntry* Value;
+	};
+		/// all the told data assertions of a KB
+	typedef std::vector<ToldValue> ToldValueVec;
+
+protected:	// types
+		/// single posting: an individual has a value
+	struct Entry
+	{
+		const TDataEntry* Value;
+		const TIndividual* Ind;
+	};
+		/// list of the postings sorted by values
+	typedef std::vector<Entry> ValueList;
+		/// map from a data role to its postings
+	typedef std::unordered_map<const TRole*, ValueList> ValueMap;
+
+protected:	// members
+		/// postings for every data role (including ones inherited from sub-roles)
+	ValueMap Values;
+		/// number of the told (role,value,individual) triples
+	size_t nValues = 0;
+
+protected:	// methods
+		/// @return true iff value V1 is less than V2; values of different types are ordered by the type index
+	static bool lessValue ( const TDataEntry* v1, const TDataEntry* v2 )
+	{
+		unsigned int t1 = v1->getType()->getTypeIndex(), t2 = v2->getType()->getTypeIndex();
+		if ( t1 != t2 )
+			return t1 < t2;
+		return v1->getComp() < v2->getComp();
+	}
+		/// @return true iff the type of value V1 precedes the type of V2
+	static bool lessType ( const TDataEntry* v1, const TDataEntry* v2 )
+		{ return v1->getType()->getTypeIndex() < v2->getType()->getTypeIndex(); }
+		/// add told value V of the individual IND via the role R (and all its super-roles) to the index
+	void addValue ( const TRole* R, const TIndividual* ind, const TDataEntry* V );
+
+public:		// interface
+		/// build index over the told data assertions TOLD
+	explicit DataValueIndex ( const ToldValueVec& told )
+	{
+		for ( const auto& value: told )
+			addValue ( value.R, value.Ind, value.Value );
+		finalise();
+	}
+		/// no copy c'tor
+	DataValueIndex ( const DataValueIndex& ) = delete;
+		/// no assignment
+	DataValueIndex& operator = ( const DataValueIndex& ) = delete;
+
+		/// sort all the postings; remove duplicates
+	void finalise ( void );
+
+		/// @return true iff the index contains value V of the individual IND via the role R
+	bool hasValue ( const TRole* R, const TIndividual* ind, const TDataEntry* V ) const;
+		/// put into RESULT all the individuals with R-values in the range between MIN and MAX. NULL bound means no
+		/// bound; MINEXCL/MAXEXCL make the corresponding bound exclusive. Both bounds should be of the same type
+	void getIndividuals ( const TRole* R, const TDataEntry* Min, bool minExcl, const TDataEntry* Max, bool maxExcl,
+						  IndividualVec& Result ) const;
+
+		/// print the index statistics
+	void print ( std::ostream& o ) const;
+}; // DataValueIndex
+
+#endif
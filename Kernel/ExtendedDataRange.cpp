@@ -104,3 +104,24 @@ ReasoningKernel :: getDataRelatedIndividuals ( TDRoleExpr* R, TDRoleExpr* S, int
 	}
 }
 
+
+/// set RESULT into set of individuals I such that A(I,v) holds for some V in [MIN,MAX]
+void
+ReasoningKernel :: getDataValueInstances ( TDRoleExpr* A, TDataValueExpr* Min, bool minExcl, TDataValueExpr* Max, bool maxExcl,
+										   IndividualSet& Result )
+{
+	realiseKB();	// ensure KB is ready to answer the query
+	Result.clear();
+	const TRole* a = getRole ( A, "Role expression expected in the getDataValueInstances()" );
+	const TDataEntry* min = Min ? getDataValue ( Min, "Data value expected in the getDataValueInstances()" ) : nullptr;
+	const TDataEntry* max = Max ? getDataValue ( Max, "Data value expected in the getDataValueInstances()" ) : nullptr;
+	if ( min && max && min->getType() != max->getType() )
+		throw EFaCTPlusPlus("Bounds of the different types in the getDataValueInstances()");
+
+	const DataValueIndex* index = getTBox()->getDataValueIndex();
+	if ( index == nullptr )
+		return;
+	DataValueIndex::IndividualVec Individuals;
+	index->getIndividuals ( a, min, minExcl, max, maxExcl, Individuals );
+	Result.insert ( Result.end(), Individuals.begin(), Individuals.end() );
+}
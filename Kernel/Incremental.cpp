@@ -28,6 +28,54 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 TsProcTimer moduleTimer, subCheckTimer;
 int nModule = 0;
 
+/// add (if ADD) or remove NAME for all the elements of SIG in Sig2Name
+void
+ReasoningKernel :: indexSig ( const TNamedEntity* name, const TSignature& sig, bool add )
+{
+	for ( const TNamedEntity* entity : sig )
+		if ( add )
+			Sig2Name[entity].insert(name);
+		else
+			Sig2Name[entity].erase(name);
+}
+
+/// add to NAMES all the names such that some axiom from [BEGIN,END) is non-local wrt their module signature
+void
+ReasoningKernel :: addNonLocalNames ( TOntology::iterator begin, TOntology::iterator end, std::set<const TNamedEntity*>& Names )
+{
+	LocalityChecker* lc = getModExtractor(SYN_LOC_STD)->getModularizer()->getLocalityChecker();
+	// module signatures are built for the BOT-modules
+	const TSignature Empty;
+	for ( TOntology::iterator p = begin; p != end; ++p )
+	{
+		// locality of an axiom depends only on the part of the signature shared with the axiom,
+		// so the axiom that is non-local wrt empty signature is non-local wrt every name
+		lc->setSignatureValue(Empty);
+		if ( !lc->local(*p) )
+		{
+			for ( NameSigMap::iterator q = Name2Sig.begin(), q_end = Name2Sig.end(); q != q_end; ++q )
+				Names.insert(q->first);
+			return;
+		}
+
+		// check only names whose module signature intersects with the axiom one
+		std::set<const TNamedEntity*> Candidates;
+		for ( const TNamedEntity* entity : (*p)->getSignature() )
+		{
+			SigNameMap::const_iterator found = Sig2Name.find(entity);
+			if ( found != Sig2Name.end() )
+				Candidates.insert ( found->second.begin(), found->second.end() );
+		}
+		for ( const TNamedEntity* name : Candidates )
+			if ( Names.count(name) == 0 )
+			{
+				lc->setSignatureValue(*Name2Sig[name]);
+				if ( !lc->local(*p) )
+					Names.insert(name);
+			}
+	}
+}
+
 /// setup Name2Sig for a given name C
 void
 ReasoningKernel :: setupSig ( const TNamedEntity* entity, const AxiomVec& Module )
@@ -43,7 +91,10 @@ ReasoningKernel :: setupSig ( const TNamedEntity* entity, const AxiomVec& Module
 	if ( insert == Name2Sig.end() )
 		insert = Name2Sig.insert(std::make_pair(entity,&sig)).first;
 	else
+	{
+		indexSig ( entity, *insert->second, /*add=*/false );
 		delete insert->second;
+	}
 
 	// calculate a module
 	sig.add(entity);
@@ -52,6 +103,7 @@ ReasoningKernel :: setupSig ( const TNamedEntity* entity, const AxiomVec& Module
 
 	// perform update
 	insert->second = new TSignature(getModExtractor(SYN_LOC_STD)->getModularizer()->getSignature());
+	indexSig ( entity, *insert->second, /*add=*/true );
 
 	moduleTimer.Stop();
 }
@@ -65,8 +117,9 @@ ReasoningKernel :: buildSignature ( const TNamedEntity* entity, const AxiomVec&
 	const AxiomVec NewModule = getModExtractor(SYN_LOC_STD)->getModularizer()->getModule();
 	if ( Module.size() == NewModule.size() )	// the same module
 		return;
-	// smaller module: recurse
-	for ( const TNamedEntity* e : getModExtractor(SYN_LOC_STD)->getModularizer()->getSignature() )
+	// smaller module: recurse; copy the signature as the recursive calls would change it
+	const TSignature ModuleSig = getModExtractor(SYN_LOC_STD)->getModularizer()->getSignature();
+	for ( const TNamedEntity* e : ModuleSig )
 		if ( toProcess.count(e) > 0 )	// need to process
 			buildSignature ( e, NewModule, toProcess );
 }
@@ -75,10 +128,9 @@ ReasoningKernel :: buildSignature ( const TNamedEntity* entity, const AxiomVec&
 void
 ReasoningKernel :: initIncremental ( void )
 {
-	delete ModSyn;
-	ModSyn = nullptr;
 	// fill the module signatures of the concepts
 	Name2Sig.clear();
+	Sig2Name.clear();
 	// found all entities
 	std::set<const TNamedEntity*> toProcess;
 	for ( TBox::c_const_iterator p = getTBox()->c_begin(), p_end = getTBox()->c_end(); p != p_end; ++p )
@@ -91,7 +143,8 @@ ReasoningKernel :: initIncremental ( void )
 	getTBox()->setNameSigMap(&Name2Sig);
 	// fill in ontology signature
 	OntoSig = Ontology.getSignature();
-	std::cout << "Init modules (" << nModule << ") time: " << moduleTimer << " sec" << std::endl;
+	if ( LLM.isWritable(llAlways) )
+		LL << "\nInit modules (" << nModule << ") time: " << moduleTimer << " seconds";
 }
 
 void
@@ -99,10 +152,6 @@ ReasoningKernel :: doIncremental ( void )
 {
 	TsProcTimer total;
 	total.Start();
-	std::cout << "Incremental!\n";
-	// re-set the modularizer to use updated ontology
-	delete ModSyn;
-	ModSyn = nullptr;
 
 	std::set<const TNamedEntity*> MPlus, MMinus;
 	std::set<const TNamedEntry*> excluded;
@@ -113,6 +162,13 @@ ReasoningKernel :: doIncremental ( void )
 	std::set_difference(OntoSig.begin(), OntoSig.end(), NewSig.begin(), NewSig.end(), inserter(RemovedEntities, RemovedEntities.begin()));
 	std::set_difference(NewSig.begin(), NewSig.end(), OntoSig.begin(), OntoSig.end(), inserter(AddedEntities, AddedEntities.begin()));
 
+	// told subsumptions of primitive concepts are changed in the loaded TBox; everything else requires a reload
+	AxiomVec Told;
+	TSignature::BaseType Replaced;
+	bool inPlace = canPatchTBox ( RemovedEntities, Told, Replaced );
+	if ( inPlace )	// new concepts are created as the ordinary ones
+		getTBox()->startTBoxUpdate();
+
 	Taxonomy* tax = getCTaxonomy();
 //	std::cout << "Original Taxonomy:";
 //	tax->print(std::cout);
@@ -126,8 +182,13 @@ ReasoningKernel :: doIncremental ( void )
 			// remove all links
 			C->getTaxVertex()->remove();
 			// update Name2Sig
-			delete Name2Sig[*e];
-			Name2Sig.erase(*e);
+			NameSigMap::iterator found = Name2Sig.find(*e);
+			if ( found != Name2Sig.end() )
+			{
+				indexSig ( *e, *found->second, /*add=*/false );
+				delete found->second;
+				Name2Sig.erase(found);
+			}
 		}
 
 	// deal with added concepts
@@ -153,7 +214,6 @@ ReasoningKernel :: doIncremental ( void )
 	// fill in M^+ and M^- sets
 	TsProcTimer t;
 	t.Start();
-	LocalityChecker* lc = getModExtractor(SYN_LOC_STD)->getModularizer()->getLocalityChecker();
 	TOntology::iterator nb = Ontology.beginUnprocessed(), ne = Ontology.end(), rb = Ontology.beginRetracted(), re = Ontology.endRetracted();
 //	TLISPOntologyPrinter pr(std::cout);
 //	TOntology::iterator q;
@@ -167,37 +227,21 @@ ReasoningKernel :: doIncremental ( void )
 //		std::cout << "Del:";
 //		(*q)->accept(pr);
 //	}
-	for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
+	addNonLocalNames ( nb, ne, MPlus );
+	addNonLocalNames ( rb, re, MMinus );
+	for ( const TNamedEntity* name : MMinus )
 	{
-		lc->setSignatureValue(*p->second);
-		for ( TOntology::iterator notProcessed = nb; notProcessed != ne; ++notProcessed )
-			if ( !lc->local(*notProcessed) )
-			{
-				MPlus.insert(p->first);
-//				std::cout << "Non-local NP axiom ";
-//				(*notProcessed)->accept(pr);
-//				std::cout << " wrt " << p->first->getName() << std::endl;
-				break;
-			}
-		for ( TOntology::iterator retracted = rb; retracted != re; retracted++ )
-			if ( !lc->local(*retracted) )
-			{
-				MMinus.insert(p->first);
-				// FIXME!! only concepts for now
-				TaxonomyVertex* v = dynamic_cast<const ClassifiableEntry*>(p->first->getEntry())->getTaxVertex();
-				if ( v->noNeighbours(true) )
-				{
-					v->addNeighbour(true,tax->getTopVertex());
-					tax->getTopVertex()->addNeighbour(false,v);
-				}
-//				std::cout << "Non-local RT axiom ";
-//				(*retracted)->accept(pr);
-//				std::cout << " wrt " << p->first->getName() << std::endl;
-				break;
-			}
+		// FIXME!! only concepts for now
+		TaxonomyVertex* v = dynamic_cast<const ClassifiableEntry*>(name->getEntry())->getTaxVertex();
+		if ( v->noNeighbours(true) )
+		{
+			v->addNeighbour(true,tax->getTopVertex());
+			tax->getTopVertex()->addNeighbour(false,v);
+		}
 	}
 	t.Stop();
-	std::cout << "Determine concepts that need reclassification: done in " << t << std::endl;
+	if ( LLM.isWritable(llAlways) )
+		LL << "\nDetermine concepts that need reclassification (" << MPlus.size() << " added, " << MMinus.size() << " removed): done in " << t << " seconds";
 
 	// build changed modules
 	std::set<const TNamedEntity*> toProcess(MPlus);
@@ -212,26 +256,53 @@ ReasoningKernel :: doIncremental ( void )
 
 	t.Reset();
 	t.Start();
-	// save taxonomy
-	SaveLoadManager SLManager("Incremental");
-	SLManager.prepare(/*input=*/false);
-	// FIXME!! for now
-	excluded.clear();
-	getTBox()->SaveTaxonomy(SLManager,excluded);
-
-	// do actual change
-	useIncrementalReasoning = false;
-	forceReload();
-	pTBox->setNameSigMap(&Name2Sig);
-	pTBox->isConsistent();
-	useIncrementalReasoning = true;
-
-	// load the taxonomy
-	SLManager.prepare(/*input=*/true);
-	getTBox()->LoadTaxonomy(SLManager);
-	t.Stop();
+	if ( inPlace )
+	{
+		try
+		{
+			patchTBox ( Told, Replaced );
+		}
+		catch ( const EFaCTPlusPlus& )
+		{
+			inPlace = false;
+		}
+	}
+
+	if ( inPlace )
+	{
+		// everything built over the old TBox is out of date
+		delete KE;
+		KE = nullptr;
+		clearSemanticModules();
+		t.Stop();
+
+		if ( LLM.isWritable(llAlways) )
+			LL << "\nPatching ontology: done in " << t << " seconds";
+	}
+	else
+	{
+		// save taxonomy in memory
+		SaveLoadManager SLManager;
+		SLManager.prepare(/*input=*/false);
+		// FIXME!! for now
+		excluded.clear();
+		getTBox()->SaveTaxonomy(SLManager,excluded);
+
+		// do actual change
+		useIncrementalReasoning = false;
+		forceReload();
+		pTBox->setNameSigMap(&Name2Sig);
+		pTBox->isConsistent();
+		useIncrementalReasoning = true;
 
-	std::cout << "Reloading ontology: done in " << t << std::endl;
+		// load the taxonomy
+		SLManager.prepare(/*input=*/true);
+		getTBox()->LoadTaxonomy(SLManager);
+		t.Stop();
+
+		if ( LLM.isWritable(llAlways) )
+			LL << "\nReloading ontology: done in " << t << " seconds";
+	}
 
 	tax = getCTaxonomy();
 //	std::cout << "Reloaded Taxonomy:";
@@ -239,12 +310,14 @@ ReasoningKernel :: doIncremental ( void )
 //	std::cout.flush();
 
 	subCheckTimer.Start();
-	getTBox()->reclassify ( MPlus, MMinus );
+	if ( getTBox()->isConsistent() )
+		getTBox()->reclassify ( MPlus, MMinus );
 	subCheckTimer.Stop();
 	Ontology.setProcessed();
 	total.Stop();
-	std::cout << "Total modularization (" << nModule << ") time: " << moduleTimer << " sec\nTotal reasoning time: " << subCheckTimer
-			  << " sec\nTotal reclassification time: " << total << " sec" << std::endl;
+	if ( LLM.isWritable(llAlways) )
+		LL << "\nTotal modularization (" << nModule << ") time: " << moduleTimer << " seconds\nTotal reasoning time: " << subCheckTimer
+		   << " seconds\nTotal reclassification time: " << total << " seconds";
 }
 
 std::ostream&
@@ -256,3 +329,228 @@ operator << ( std::ostream& o, const TSignature& sig )
 	o << "]" << std::endl;
 	return o;
 }
+
+//-------------------------------------------------------------
+// Incremental TBox update
+//-------------------------------------------------------------
+
+const TDLConceptName*
+ReasoningKernel :: getToldSubsumptionName ( const TDLAxiom* axiom )
+{
+	const TDLAxiomConceptInclusion* incl = dynamic_cast<const TDLAxiomConceptInclusion*>(axiom);
+	return incl == nullptr ? nullptr : dynamic_cast<const TDLConceptName*>(incl->getSubC());
+}
+
+/// @return true iff ENTITY is a concept name that is either fresh or primitive in the loaded TBox
+static bool
+isPrimitiveConceptName ( const TNamedEntity* entity )
+{
+	if ( dynamic_cast<const TDLConceptName*>(entity) == nullptr )
+		return false;
+	const TConcept* C = static_cast<const TConcept*>(entity->getEntry());
+	return C == nullptr || ( !C->isSystem() && C->isPrimitive() && !C->isSynonym() && !C->isTop() && !C->isBottom() );
+}
+
+bool
+ReasoningKernel :: isTBoxPatch ( TDLAxiom* axiom )
+{
+	if ( const TDLAxiomDeclaration* decl = dynamic_cast<const TDLAxiomDeclaration*>(axiom) )
+	{
+		const TDLConceptName* C = dynamic_cast<const TDLConceptName*>(decl->getDeclaration());
+		return C != nullptr && isPrimitiveConceptName(C);
+	}
+	const TDLConceptName* C = getToldSubsumptionName(axiom);
+	if ( C == nullptr || !isPrimitiveConceptName(C) )
+		return false;
+	// only concepts might be new; roles should be known to the TBox
+	for ( const TNamedEntity* entity : axiom->getSignature() )
+	{
+		const TNamedEntry* entry = entity->getEntry();
+		if ( dynamic_cast<const TDLIndividualName*>(entity) != nullptr )
+			return false;
+		if ( entry == nullptr ? dynamic_cast<const TDLConceptName*>(entity) == nullptr : entry->isSystem() )
+			return false;
+	}
+	return true;
+}
+
+bool
+ReasoningKernel :: canPatchTBox ( const TSignature::BaseType& Removed, AxiomVec& Told, TSignature::BaseType& Replaced )
+{
+	if ( !getTBox()->canUpdateTBox() )
+		return false;
+
+	// removed roles and individuals might be used anywhere in the TBox
+	for ( const TNamedEntity* entity : Removed )
+		if ( dynamic_cast<const TDLConceptName*>(entity) == nullptr )
+			return false;
+
+	// the told subsumptions of a concept that lost some of them are rebuilt
+	for ( TOntology::iterator p = Ontology.beginRetracted(), p_end = Ontology.endRetracted(); p != p_end; ++p )
+	{
+		if ( !isTBoxPatch(*p) )
+			return false;
+		if ( const TDLConceptName* C = getToldSubsumptionName(*p) )
+			Replaced.insert(C);
+	}
+	// the new told subsumptions of the other concepts are added
+	for ( TOntology::iterator p = Ontology.beginUnprocessed(), p_end = Ontology.end(); p != p_end; ++p )
+		if ( (*p)->isUsed() )
+		{
+			if ( !isTBoxPatch(*p) )
+				return false;
+			const TDLConceptName* C = getToldSubsumptionName(*p);
+			if ( C != nullptr && Replaced.count(C) == 0 )
+				Told.push_back(*p);
+		}
+
+	if ( Replaced.empty() )
+		return true;
+
+	// the rebuilt concepts should be defined by their told subsumptions only;
+	// every other axiom that mentions them (like an absorbed GCI) contributes to some non-primitive entry
+	for ( TDLAxiom* axiom : Ontology.getAxioms() )
+		if ( axiom->isUsed() )
+		{
+			const TDLConceptName* C = getToldSubsumptionName(axiom);
+			if ( C != nullptr && Replaced.count(C) > 0 )
+			{
+				Told.push_back(axiom);
+				continue;
+			}
+			for ( const TNamedEntity* entity : axiom->getSignature() )
+				if ( Replaced.count(entity) > 0 && ( C == nullptr || !isPrimitiveConceptName(C) ) )
+					return false;
+		}
+
+	return true;
+}
+
+void
+ReasoningKernel :: patchTBox ( const AxiomVec& Told, const TSignature::BaseType& Replaced )
+{
+	TBox* tbox = getTBox();
+	for ( const TNamedEntity* entity : Replaced )
+		tbox->clearToldSubsumptions(static_cast<TConcept*>(entity->getEntry()));
+	for ( const TDLAxiom* axiom : Told )
+	{
+		const TDLAxiomConceptInclusion* incl = static_cast<const TDLAxiomConceptInclusion*>(axiom);
+		TConcept* C = static_cast<TConcept*>(getToldSubsumptionName(axiom)->getEntry());
+		tbox->addToldSubsumption ( C, e(incl->getSupC()) );
+	}
+	tbox->finishTBoxUpdate();
+}
+
+//-------------------------------------------------------------
+// Incremental ABox update
+//-------------------------------------------------------------
+
+bool
+ReasoningKernel :: isABoxAssertion ( const TDLAxiom* axiom )
+{
+	if ( const TDLAxiomDeclaration* decl = dynamic_cast<const TDLAxiomDeclaration*>(axiom) )
+		return dynamic_cast<const TDLIndividualName*>(decl->getDeclaration()) != nullptr;
+	return dynamic_cast<const TDLAxiomInstanceOf*>(axiom) != nullptr
+		|| dynamic_cast<const TDLAxiomRelatedTo*>(axiom) != nullptr
+		|| dynamic_cast<const TDLAxiomValueOf*>(axiom) != nullptr;
+}
+
+bool
+ReasoningKernel :: addABoxAssertion ( const TDLAxiom* axiom )
+{
+	if ( const TDLAxiomDeclaration* decl = dynamic_cast<const TDLAxiomDeclaration*>(axiom) )
+	{
+		const TDLIndividualName* I = dynamic_cast<const TDLIndividualName*>(decl->getDeclaration());
+		if ( I == nullptr )	// new concept or role
+			return false;
+		getIndividual ( I, "Individual expected in Declaration axiom" );
+		return true;
+	}
+	if ( const TDLAxiomInstanceOf* inst = dynamic_cast<const TDLAxiomInstanceOf*>(axiom) )
+		return getTBox()->addInstanceAssertion (
+			getIndividual ( inst->getIndividual(), "Individual expected in Instance axiom" ),
+			e(inst->getC()) );
+	if ( const TDLAxiomRelatedTo* rel = dynamic_cast<const TDLAxiomRelatedTo*>(axiom) )
+	{
+		TRole* R = getRole ( rel->getRelation(), "Role expression expected in Related To axiom" );
+		if ( R->isBottom() )	// inconsistent KB; let the reload report it
+			return false;
+		if ( R->isTop() )	// nothing to do for universal role
+			return true;
+		return getTBox()->addRelatedAssertion (
+			getIndividual ( rel->getIndividual(), "Individual expected in Related To axiom" ),
+			R,
+			getIndividual ( rel->getRelatedIndividual(), "Individual expected in Related To axiom" ) );
+	}
+	if ( const TDLAxiomValueOf* val = dynamic_cast<const TDLAxiomValueOf*>(axiom) )
+	{
+		TRole* A = getRole ( val->getAttribute(), "Role expression expected in Value Of axiom" );
+		if ( A->isBottom() )	// inconsistent KB; let the reload report it
+			return false;
+		if ( A->isTop() )	// nothing to do for universal role
+			return true;
+		return getTBox()->addInstanceAssertion (
+			getIndividual ( val->getIndividual(), "Individual expected in Value Of axiom" ),
+			createSNFExists ( e(val->getAttribute()), e(val->getValue()) ) );
+	}
+	// any other axiom might change the TBox
+	return false;
+}
+
+bool
+ReasoningKernel :: updateABox ( void )
+{
+	// the KB should be loaded, and only additions are allowed
+	if ( pTBox == nullptr || pSLManager != nullptr || !getTBox()->canUpdateABox() )
+		return false;
+	if ( Ontology.beginRetracted() != Ontology.endRetracted() )
+		return false;
+
+	// only assertions are allowed; only individuals might be new, all other names should be known to the TBox
+	for ( TOntology::iterator p = Ontology.beginUnprocessed(), p_end = Ontology.end(); p != p_end; ++p )
+	{
+		if ( (*p)->isUsed() && !isABoxAssertion(*p) )
+			return false;
+		for ( const TNamedEntity* entity : (*p)->getSignature() )
+		{
+			const TNamedEntry* entry = entity->getEntry();
+			if ( entry == nullptr ? dynamic_cast<const TDLIndividualName*>(entity) == nullptr : entry->isSystem() )
+				return false;
+		}
+	}
+
+	getTBox()->startABoxUpdate();
+	bool updated = true;
+	try
+	{
+		for ( TOntology::iterator p = Ontology.beginUnprocessed(), p_end = Ontology.end(); updated && p != p_end; ++p )
+			if ( (*p)->isUsed() )
+				updated = addABoxAssertion(*p);
+	}
+	catch ( const EFaCTPlusPlus& )
+	{
+		updated = false;
+	}
+
+	// some of the assertions are in the TBox already, so it can't be used anymore
+	if ( !updated )
+	{
+		if ( LLM.isWritable(llAlways) )
+			LL << "\nABox update failed; reloading the ontology";
+		forceReload();
+		return true;
+	}
+
+	getTBox()->finishABoxUpdate();
+
+	// nothing was built for the new axioms yet; the new individuals are bound to the TBox entries
+	clearQueryCache();
+	clearSemanticModules();
+
+	// assertions do not change the concept hierarchy of a consistent KB, so the concept modules are kept
+	if ( useIncrementalReasoning )
+		OntoSig = Ontology.getSignature();
+
+	Ontology.setProcessed();
+	return true;
+}
@@ -57,6 +57,25 @@ void TBox :: addSubsumeAxiom ( DLTree* sub, DLTree* sup )
 		processGCI ( sub, sup );
 }
 
+void
+TBox :: addToldDataValues ( const TIndividual* I, const DLTree* C )
+{
+	if ( C->Element() == AND )
+	{
+		addToldDataValues ( I, C->Left() );
+		addToldDataValues ( I, C->Right() );
+		return;
+	}
+
+	// ER.V is represented as \not\AR.\not V
+	if ( C->Element() != NOT || C->Left()->Element() != FORALL )
+		return;
+	const DLTree* R = C->Left()->Left();
+	const DLTree* V = C->Left()->Right();
+	if ( R->Element().getToken() == DNAME && V->Element() == NOT && isDataValue(V->Left()) )
+		ToldDataValues.push_back ( { resolveRole(R), I, static_cast<const TDataEntry*>(V->Left()->Element().getNE()) } );
+}
+
 /// tries to apply axiom D [= CN; @return NULL if applicable or new CN
 DLTree*
 TBox :: applyAxiomCToCN ( DLTree* D, DLTree* CN )
@@ -0,0 +1,86 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <ostream>
+
+#include "InstanceIndex.h"
+#include "tConcept.h"
+
+/// walker that gathers all the vertices it applied to
+class VertexGatheringWalker: public WalkerInterface
+{
+public:		// members
+		/// vertices found
+	std::vector<const TaxonomyVertex*> found;
+
+public:		// interface
+		/// gather every vertex
+	bool apply ( const TaxonomyVertex& v ) override
+	{
+		found.push_back(&v);
+		return true;
+	}
+}; // VertexGatheringWalker
+
+bool
+InstanceIndex :: hasIndividual ( const TaxonomyVertex& v )
+{
+	if ( static_cast<const TConcept*>(v.getPrimer())->isSingleton() )
+		return true;
+	for ( const auto& synonym: v.synonyms() )
+		if ( static_cast<const TConcept*>(synonym)->isSingleton() )
+			return true;
+	return false;
+}
+
+InstanceIndex :: InstanceIndex ( Taxonomy* tax )
+{
+	// gather all the vertices of the taxonomy
+	VertexGatheringWalker vertices;
+	tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/false> ( tax->getTopVertex(), vertices );
+
+	for ( const TaxonomyVertex* v: vertices.found )
+		All[v];
+
+	// add every vertex with individuals to the lists of its parents and ancestors
+	for ( const TaxonomyVertex* v: vertices.found )
+	{
+		if ( !hasIndividual(*v) )
+			continue;
+		++nIndVertices;
+
+		for ( TaxonomyVertex::const_iterator p = v->begin(/*upDirection=*/true), p_end = v->end(/*upDirection=*/true); p != p_end; ++p )
+			Direct[*p].push_back(v);
+
+		VertexGatheringWalker ancestors;
+		tax->getRelativesInfo</*needCurrent=*/false, /*onlyDirect=*/false, /*upDirection=*/true> ( const_cast<TaxonomyVertex*>(v), ancestors );
+		for ( const TaxonomyVertex* anc: ancestors.found )
+			All[anc].push_back(v);
+	}
+}
+
+void
+InstanceIndex :: print ( std::ostream& o ) const
+{
+	size_t nPostings = 0;
+	for ( const auto& list: All )
+		nPostings += list.second.size();
+	o << "Instance index: " << nIndVertices << " individual vertices, " << All.size()
+	  << " concept vertices, " << nPostings << " postings\n";
+}
@@ -0,0 +1,89 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef INSTANCEINDEX_H
+#define INSTANCEINDEX_H
+
+#include <unordered_map>
+
+#include "Taxonomy.h"
+
+/// concept -> instances posting lists built over the realised concept taxonomy
+class InstanceIndex
+{
+protected:	// types
+		/// posting list: vertices that contain individuals
+	typedef std::vector<const TaxonomyVertex*> PostingList;
+		/// map from a vertex to its posting list
+	typedef std::unordered_map<const TaxonomyVertex*, PostingList> PostingMap;
+
+protected:	// members
+		/// all instances of a vertex (excluding the vertex itself)
+	PostingMap All;
+		/// direct instances of a vertex
+	PostingMap Direct;
+		/// empty list to return for the vertices without instances
+	const PostingList Empty;
+		/// total number of the vertices with individuals
+	size_t nIndVertices = 0;
+
+protected:	// methods
+		/// @return true iff vertex V contains an individual
+	static bool hasIndividual ( const TaxonomyVertex& v );
+		/// @return posting list for vertex V in map M
+	const PostingList& getList ( const PostingMap& m, const TaxonomyVertex* v ) const
+	{
+		PostingMap::const_iterator p = m.find(v);
+		return p == m.end() ? Empty : p->second;
+	}
+
+public:		// interface
+		/// build index for a realised taxonomy TAX
+	explicit InstanceIndex ( Taxonomy* tax );
+		/// no copy c'tor
+	InstanceIndex ( const InstanceIndex& ) = delete;
+		/// no assignment
+	InstanceIndex& operator = ( const InstanceIndex& ) = delete;
+
+		/// @return true iff the index knows about the vertex V (ie, V is a vertex of the taxonomy)
+	bool isIndexed ( const TaxonomyVertex* v ) const { return All.count(v) > 0; }
+
+		/// apply ACTOR to V and to all vertices that are its instances
+	template<class Actor>
+	void getInstances ( const TaxonomyVertex* v, Actor& actor ) const
+	{
+		actor.apply(*v);
+		for ( const TaxonomyVertex* ind: getList ( All, v ) )
+			actor.apply(*ind);
+	}
+		/// apply ACTOR to V, and if there is no instances there, to all its direct instances
+	template<class Actor>
+	void getDirectInstances ( const TaxonomyVertex* v, Actor& actor ) const
+	{
+		if ( actor.apply(*v) )
+			return;
+		for ( const TaxonomyVertex* ind: getList ( Direct, v ) )
+			actor.apply(*ind);
+	}
+
+		/// print the index statistics
+	void print ( std::ostream& o ) const;
+}; // InstanceIndex
+
+#endif
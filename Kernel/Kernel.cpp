@@ -17,11 +17,15 @@ License along with this library; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "Kernel.h"
 #include "tOntologyLoader.h"
 #include "tOntologyPrinterLISP.h"
 #include "AtomicDecomposer.h"
 #include "OntologyBasedModularizer.h"
+#include "SemanticLocalityChecker.h"
 #include "eFPPSaveLoad.h"
 #include "SaveLoadManager.h"
 
@@ -56,6 +60,7 @@ ReasoningKernel :: ReasoningKernel ( void )
 ReasoningKernel :: ~ReasoningKernel()
 {
 	clearTBox();
+	clearModules();
 	deleteTree(cachedQueryTree);
 	delete pMonitor;
 	delete pSLManager;
@@ -73,6 +78,16 @@ ReasoningKernel :: clearTBox ( void )
 	pET = nullptr;
 	delete KE;
 	KE = nullptr;
+	// AD and syntactic modularizers depend only on the ontology and follow its changes themselves
+	clearSemanticModules();
+	// during preprocessing the TBox names were cached. clear that cache now.
+	getExpressionManager()->clearNameCache();
+}
+
+/// clear AD and modularizers built for the axioms of the ontology
+void
+ReasoningKernel :: clearModules ( void )
+{
 	delete AD;
 	AD = nullptr;
 	delete ModSem;
@@ -81,8 +96,21 @@ ReasoningKernel :: clearTBox ( void )
 	ModSyn = nullptr;
 	delete ModSynCount;
 	ModSynCount = nullptr;
-	// during preprocessing the TBox names were cached. clear that cache now.
-	getExpressionManager()->clearNameCache();
+}
+
+/// clear the semantic modularizer and the AD built with it
+void
+ReasoningKernel :: clearSemanticModules ( void )
+{
+	// the reasoner of the semantic locality checker binds the entities to its own entries, so it can't
+	// survive the TBox that binds them back
+	if ( AD != nullptr && ADMethod == SEM_LOC )
+	{
+		delete AD;
+		AD = nullptr;
+	}
+	delete ModSem;
+	ModSem = nullptr;
 }
 
 bool
@@ -127,7 +155,8 @@ ReasoningKernel :: forceReload ( void )
 		Ontology.visitOntology(OntologyPrinter);
 	}
 
-	if ( useIncrementalReasoning )
+	// module signatures would be restored together with the saved state
+	if ( useIncrementalReasoning && ( pSLManager == nullptr || !pSLManager->existsContent() ) )
 		initIncremental();
 
 	// after loading ontology became processed completely
@@ -155,6 +184,7 @@ ReasoningKernel :: ClassifyOrLoad ( bool needIndividuals )
 				// fail to load -- fall through to the real action
 			}
 		}
+		ensureIncremental();
 	}
 	// perform the real classification
 	if ( needIndividuals )
@@ -176,6 +206,10 @@ ReasoningKernel :: processKB ( KBStatus status )
 	if ( reasoningFailed )
 		throw EFaCTPlusPlus("Can't answer queries due to previous errors");
 
+	// the changes of an open batch are not visible, so use the last committed KB; a KB that was never checked is not one
+	if ( batchOpen && ( pTBox == nullptr || pTBox->getStatus() < kbCChecked ) )
+		throw EFaCTPlusPlus("FaCT++ Kernel: no committed KB to answer queries during the batch");
+
 	KBStatus curStatus = getStatus();
 
 	if ( curStatus >= status )
@@ -185,13 +219,21 @@ ReasoningKernel :: processKB ( KBStatus status )
 		return;
 	}
 
+	// the taxonomy is going to change, so the positions of the classified queries are not valid anymore
+	clearQueryCache();
+	clearClassifiedQueries();
+
 	// here curStatus < kbRealised, and status >= kbChecked
 	if ( curStatus == kbEmpty || curStatus == kbLoading )
 	{	// load and preprocess KB -- here might be failures
 		reasoningFailed = true;
 
-		// load the axioms from the ontology to the TBox
-		if ( needForceReload() )
+		// load the axioms from the ontology to the TBox; incremental reasoning always patches new ABox in place
+		if ( ( useIncrementalABox || useIncrementalReasoning ) && updateABox() )
+		{
+			// only new ABox assertions were there; they are in the (possibly reloaded) TBox now
+		}
+		else if ( needForceReload() )
 			forceReload();
 		else	// just do incremental classification and exit
 		{
@@ -208,7 +250,11 @@ ReasoningKernel :: processKB ( KBStatus status )
 
 		// if the consistency check is all we need -- return
 		if ( status == kbCChecked )
+		{
+			// nothing would be loaded, so make sure the incremental bits are there
+			ensureIncremental();
 			return;
+		}
 	}
 
 	// here we need to do classification or realisation
@@ -219,6 +265,72 @@ ReasoningKernel :: processKB ( KBStatus status )
 	ClassifyOrLoad(status == kbRealised);
 }
 
+//-----------------------------------------------------------------------------
+//--		batch updates
+//-----------------------------------------------------------------------------
+
+/// start collecting ontology changes into a batch
+void
+ReasoningKernel :: beginBatch ( void )
+{
+	if ( batchOpen )
+		throw EFaCTPlusPlus("FaCT++ Kernel: batch of changes is already open");
+	batchOpen = true;
+	LastBatch = BatchReport();
+	batchQueryVersion = Ontology.getVersion();
+}
+
+/// validate changes of the batch and process them in one go
+const ReasoningKernel::BatchReport&
+ReasoningKernel :: commitBatch ( void )
+{
+	if ( !batchOpen )
+		throw EFaCTPlusPlus("FaCT++ Kernel: no open batch of changes to commit");
+
+	// every retracted axiom should be in the ontology and be retracted only once
+	std::set<const TDLAxiom*> retracted;
+	const char* error = nullptr;
+	auto isBad = [&] ( const TDLAxiom* axiom )
+	{
+		if ( !Ontology.contains(axiom) )
+			error = "FaCT++ Kernel: retracted axiom does not belong to the ontology";
+		else if ( !retracted.insert(axiom).second )
+			error = "FaCT++ Kernel: axiom is retracted twice in the batch";
+		else
+			return false;
+		return true;
+	};
+	if ( std::any_of ( Ontology.beginRetracted(), Ontology.endRetracted(), isBad ) )
+	{	// cancel all the bad retractions and keep the batch open
+		retracted.clear();
+		Ontology.cancelRetractions(isBad);
+		throw EFaCTPlusPlus(error);
+	}
+	batchOpen = false;
+
+	LastBatch.nAdded = static_cast<size_t>(Ontology.end() - Ontology.beginUnprocessed());
+	LastBatch.nRetracted = retracted.size();
+
+	// nothing to do if the KB was not reasoned with or there are no changes
+	if ( pTBox == nullptr || !Ontology.isChanged() )
+		return LastBatch;
+	KBStatus status = pTBox->getStatus();
+	if ( status < kbCChecked )
+		return LastBatch;
+
+	TsProcTimer t;
+	t.Start();
+	// bring the changed KB to the same state as the committed one
+	processKB(status);
+	t.Stop();
+	LastBatch.time = t;
+
+	if ( LLM.isWritable(llAlways) )
+		LL << "\nBatch of " << LastBatch.nAdded << " added and " << LastBatch.nRetracted << " retracted axioms is processed in "
+		   << t << " seconds; " << LastBatch.nReloadsSaved << " KB reloads during the batch were saved";
+	return LastBatch;
+}
+
 //-----------------------------------------------------------------------------
 //--		query caching support
 //-----------------------------------------------------------------------------
@@ -247,6 +359,10 @@ ReasoningKernel :: classifyQuery ( void )
 		cachedVertex = getCTaxonomy()->getFreshVertex(cachedConcept);
 	}
 
+	// remember the position of a complex query; the current taxonomy vertex is re-used, so it is copied
+	if ( complexQuery && cachedQuery != nullptr && !ignoreExprCache )
+		ClassifiedQueries.add ( cachedQuery, cachedVertex, cachedVertex == getCTaxonomy()->getCurrent() );
+
 	// setup proper cache level
 	cacheLevel = csClassified;
 }
@@ -255,8 +371,8 @@ void
 ReasoningKernel :: setUpSatCache ( DLTree* query )
 {
 	// if KB was changed since it was classified,
-	// we should catch it before
-	fpp_assert ( !Ontology.isChanged() );
+	// we should catch it before (unless the changes are in the open batch)
+	fpp_assert ( !Ontology.isChanged() || batchOpen );
 
 	// check if the query is already cached
 	if ( checkQueryCache(query) )
@@ -282,13 +398,16 @@ void
 ReasoningKernel :: setUpCache ( TConceptExpr* query, cacheStatus level )
 {
 	// if KB was changed since it was classified,
-	// we should catch it before
-	fpp_assert ( !Ontology.isChanged() );
+	// we should catch it before (unless the changes are in the open batch)
+	fpp_assert ( !Ontology.isChanged() || batchOpen );
 
 	// check if the query is already cached
 	if ( checkQueryCache(query) )
 	{
 		fpp_assert ( cacheLevel != csEmpty );
+		// position was taken from the classified queries, but the query concept is necessary now
+		if ( unlikely(cachedConcept == nullptr) && level == csSat )
+			setQueryConcept(TreeDeleter(e(query)));
 		// query cached with the same or lower level -- nothing to do
 		if ( level <= cacheLevel )
 			return;
@@ -303,6 +422,18 @@ ReasoningKernel :: setUpCache ( TConceptExpr* query, cacheStatus level )
 	// clear currently cached query
 	clearQueryCache();
 
+	// complex query might be classified recently
+	if ( level == csClassified && !ignoreExprCache && !isNameOrConst(query) )
+	{
+		if ( TaxonomyVertex* vertex = ClassifiedQueries.get(query) )
+		{
+			setQueryCache(query);
+			cachedVertex = vertex;
+			cacheLevel = csClassified;
+			return;
+		}
+	}
+
 	// setup concept to be queried
 	setQueryConcept(TreeDeleter(e(query)));
 
@@ -357,13 +488,185 @@ ReasoningKernel :: checkSub ( TConcept* C, TConcept* D )
 		return true;
 	if ( getStatus() < kbClassified )	// unclassified => do via SAT test
 		return getTBox()->isSubHolds ( C, D );
+	return isBelow ( C->getTaxVertex(), D );
+}
+
+/// @return true iff the taxonomy vertex V is below the named concept D in the classified KB
+bool
+ReasoningKernel :: isBelow ( TaxonomyVertex* v, TConcept* D )
+{
+	Taxonomy* tax = getCTaxonomy();
+	// classified and indexed => direct lookup
+	if ( tax->isIndexed(v) && tax->isIndexed(D->getTaxVertex()) )
+		return tax->isSubVertex ( v, D->getTaxVertex() );
 	// classified => do the taxonomy traversal
 	SupConceptActor actor(D);
-	Taxonomy* tax = getCTaxonomy();
-	try { tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/true> ( C->getTaxVertex(), actor ); return false; }
+	try { tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/true> ( v, actor ); return false; }
 	catch (...) { tax->clearVisited(); return true; }
 }
 
+//-------------------------------------------------
+// batch queries implementation
+//-------------------------------------------------
+
+/// @return indices of the queries C ordered such that the queries with the same concept are consecutive
+static std::vector<size_t>
+groupQueries ( const ReasoningKernel::ConceptVec& C )
+{
+	std::vector<size_t> Order(C.size());
+	for ( size_t i = 0; i < Order.size(); ++i )
+		Order[i] = i;
+	std::stable_sort ( Order.begin(), Order.end(), [&C] ( size_t i, size_t j ) { return C[i] < C[j]; } );
+	return Order;
+}
+
+/// set the i-th bit of RESULT iff C[i] is satisfiable
+void
+ReasoningKernel :: isSatisfiable ( const ConceptVec& C, QueryResultBits& Result )
+{
+	Result.assign ( (C.size()+7)/8, 0 );
+	if ( C.empty() )
+		return;
+	preprocessKB();
+	// the same concepts are in a row, so they would be answered by the query cache
+	for ( size_t i: groupQueries(C) )
+		if ( isSatisfiable(C[i]) )
+			Result[i/8] |= 1 << (i%8);
+}
+
+/// set the i-th bit of RESULT iff C[i] [= D[i] holds
+void
+ReasoningKernel :: isSubsumedBy ( const ConceptVec& C, const ConceptVec& D, QueryResultBits& Result )
+{
+	if ( C.size() != D.size() )
+		throw EFaCTPlusPlus("FaCT++ Kernel: different number of sub- and super-concepts in the batch subsumption query");
+	Result.assign ( (C.size()+7)/8, 0 );
+	if ( C.empty() )
+		return;
+	preprocessKB();
+
+	std::vector<size_t> Order = groupQueries(C);
+	for ( size_t k = 0, n = Order.size(); k < n; )
+	{
+		// find the queries with the same sub-concept
+		TConceptExpr* sub = C[Order[k]];
+		size_t end = k;
+		while ( end < n && C[Order[end]] == sub )
+			++end;
+
+		// a complex sub-concept with several super-concepts is classified once; every named super-concept
+		// is then checked in the taxonomy instead of the separate satisfiability test
+		bool useTaxonomy = isKBClassified() && end - k > 1 && !isNameOrConst(sub);
+		for ( ; k < end; ++k )
+		{
+			size_t i = Order[k];
+			bool holds;
+			TConcept* sup = nullptr;
+			if ( useTaxonomy && isNameOrConst(D[i]) )
+			{
+				sup = getTBox()->getCI(TreeDeleter(e(D[i])));
+				if ( !isValid(sup->pName) || sup->getTaxVertex() == nullptr )	// fresh concept
+					sup = nullptr;
+			}
+			if ( sup != nullptr )
+			{
+				setUpCache ( sub, csClassified );
+				holds = isBelow ( cachedVertex, sup );
+			}
+			else
+				holds = isSubsumedBy ( sub, D[i] );
+			if ( holds )
+				Result[i/8] |= 1 << (i%8);
+		}
+	}
+}
+
+//-------------------------------------------------
+// flat taxonomy export
+//-------------------------------------------------
+
+/// export the concept taxonomy in the flat form
+void
+ReasoningKernel :: getConceptTaxonomy ( NamesVector& Names, std::vector<unsigned int>& Structure )
+{
+	classifyKB();	// ensure KB is ready to answer the query
+	Names.clear();
+	Structure.clear();
+
+	// number the vertices with visible names (as the actors see them)
+	const Taxonomy* tax = getCTaxonomy();
+	auto addName = [&Names] ( const ClassifiableEntry* p )
+	{
+		if ( !p->isSystem() && !static_cast<const TConcept*>(p)->isSingleton() )
+			Names.push_back(p);
+	};
+	std::unordered_map<const TaxonomyVertex*, unsigned int> Number;
+	std::vector<const TaxonomyVertex*> Vertices;
+	std::vector<unsigned int> nNames;
+	for ( const TaxonomyVertex* v: *tax )
+	{
+		if ( unlikely(!v->isInUse()) )
+			continue;
+		size_t n = Names.size();
+		addName(v->getPrimer());
+		for ( const auto& synonym: v->synonyms() )
+			addName(synonym);
+		if ( Names.size() == n )
+			continue;
+		Number.emplace ( v, static_cast<unsigned int>(Vertices.size()) );
+		Vertices.push_back(v);
+		nNames.push_back(static_cast<unsigned int>(Names.size() - n));
+	}
+
+	// the direct parents of a vertex are the closest visible vertices above it
+	Structure.push_back(static_cast<unsigned int>(Vertices.size()));
+	std::vector<const TaxonomyVertex*> ToVisit, Parents;
+	std::set<const TaxonomyVertex*> Visited;
+	for ( size_t i = 0; i < Vertices.size(); ++i )
+	{
+		Parents.clear();
+		bool hidden = false;
+		ToVisit.assign ( Vertices[i]->begin(/*upDirection=*/true), Vertices[i]->end(/*upDirection=*/true) );
+		Visited.clear();
+		while ( !ToVisit.empty() )
+		{
+			const TaxonomyVertex* u = ToVisit.back();
+			ToVisit.pop_back();
+			if ( !Visited.insert(u).second )
+				continue;
+			if ( likely(Number.count(u) > 0) )
+				Parents.push_back(u);
+			else
+			{
+				hidden = true;
+				ToVisit.insert ( ToVisit.end(), u->begin(/*upDirection=*/true), u->end(/*upDirection=*/true) );
+			}
+		}
+
+		// parents found through hidden vertices might be above one another; keep only the lowest ones
+		if ( hidden && Parents.size() > 1 )
+		{
+			Visited.clear();
+			for ( const TaxonomyVertex* p: Parents )
+				ToVisit.insert ( ToVisit.end(), p->begin(/*upDirection=*/true), p->end(/*upDirection=*/true) );
+			while ( !ToVisit.empty() )
+			{
+				const TaxonomyVertex* u = ToVisit.back();
+				ToVisit.pop_back();
+				if ( Visited.insert(u).second )
+					ToVisit.insert ( ToVisit.end(), u->begin(/*upDirection=*/true), u->end(/*upDirection=*/true) );
+			}
+			Parents.erase ( std::remove_if ( Parents.begin(), Parents.end(),
+				[&Visited] ( const TaxonomyVertex* p ) { return Visited.count(p) > 0; } ), Parents.end() );
+		}
+
+		Structure.push_back(nNames[i]);
+		Structure.push_back(static_cast<unsigned int>(Parents.size()));
+		for ( const TaxonomyVertex* p: Parents )
+			Structure.push_back(Number[p]);
+	}
+}
+
 //-------------------------------------------------
 // all-disjoint query implementation
 //-------------------------------------------------
@@ -539,6 +842,14 @@ ReasoningKernel :: isRelated ( const TIndividualExpr* I, const TORoleExpr* R, co
 bool
 ReasoningKernel :: isRelated ( const TIndividualExpr* I, const TDRoleExpr* A, const TDataValueExpr* V )
 {
+	realiseKB();	// ensure KB is ready to answer the query
+	const DataValueIndex* index = getTBox()->getDataValueIndex();
+	if ( index != nullptr && index->hasValue ( getRole ( A, "Role expression expected in the isRelated()" ),
+											  getIndividual ( I, "Individual name expected in the isRelated()" ),
+											  getDataValue ( V, "Data value expected in the isRelated()" ) ) )
+		return true;
+
+	// the value might be entailed without being in the model
 	TDLConceptDataValue exists(A, V);
 	return isInstance(I, &exists);
 }
@@ -547,16 +858,70 @@ ReasoningKernel :: isRelated ( const TIndividualExpr* I, const TDRoleExpr* A, co
 // atomic decomposition queries
 //----------------------------------------------------------------------------------
 
+/// @return extension of the file with the AD saved for given METHOD and TYPE
+static std::string
+getADExtension ( ModuleMethod method, ModuleType type )
+{
+	return ".fpp.ad" + std::to_string(method) + std::to_string(type);
+}
+
 	/// create new atomic decomposition of the loaded ontology using TYPE. @return size of the AD
 size_t
 ReasoningKernel :: getAtomicDecompositionSize ( ModuleMethod moduleMethod, ModuleType moduleType )
 {
+	// AD is saved only in a persistent S/L context
+	const bool persistent = pSLManager != nullptr && !pSLManager->isInMemory();
+
+	// the AD built for the same method and type is updated wrt ontology changes
+	if ( AD != nullptr && ADMethod == moduleMethod && AD->getType() == moduleType )
+	{
+		if ( AD->updateAOS(&Ontology) && persistent )
+			SaveAD ( moduleMethod, moduleType );
+		return AD->getAOS()->size();
+	}
+
 	// init AD field
 	if ( unlikely(AD != nullptr) )
 		delete AD;
 
 	AD = new AtomicDecomposer(getModExtractor(moduleMethod)->getModularizer());
-	return AD->getAOS ( &Ontology, moduleType )->size();
+	ADMethod = moduleMethod;
+
+	// try to reuse the AD saved for the same ontology
+	if ( persistent && LoadAD ( moduleMethod, moduleType ) )
+		return AD->getAOS()->size();
+
+	size_t size = AD->getAOS ( &Ontology, moduleType )->size();
+	if ( persistent )
+		SaveAD ( moduleMethod, moduleType );
+	return size;
+}
+	/// save the AD built using METHOD and TYPE in the S/L context
+void
+ReasoningKernel :: SaveAD ( ModuleMethod moduleMethod, ModuleType moduleType )
+{
+	SaveLoadManager m ( pSLManager->getName(), getADExtension ( moduleMethod, moduleType ) );
+	m.prepare(/*input=*/false);
+	AD->Save ( m, &Ontology, moduleMethod );
+}
+	/// load the AD for METHOD and TYPE from the S/L context. @return true if succeed
+bool
+ReasoningKernel :: LoadAD ( ModuleMethod moduleMethod, ModuleType moduleType )
+{
+	SaveLoadManager m ( pSLManager->getName(), getADExtension ( moduleMethod, moduleType ) );
+	if ( !m.existsContent() )
+		return false;
+	try
+	{
+		m.prepare(/*input=*/true);
+		AD->Load ( m, &Ontology, moduleMethod, moduleType );
+		return true;
+	}
+	catch ( const EFPPSaveLoad& )
+	{
+		// saved AD is outdated -- build a new one
+		return false;
+	}
 }
 	/// get a set of axioms that corresponds to the atom with the id INDEX
 const TOntologyAtom::AxiomSet&
@@ -584,6 +949,22 @@ ReasoningKernel :: getLocCheckNumber ( void ) const
 	return AD->getLocCheckNumber();
 }
 
+	/// get a number of locality checks for creating an AD that were answered by the syntactic pre-check of semantic locality
+unsigned long long
+ReasoningKernel :: getSynLocCheckNumber ( void ) const
+{
+	const SemanticLocalityChecker* LC = dynamic_cast<const SemanticLocalityChecker*>(AD->getLocalityChecker());
+	return LC ? LC->getNSynLocal() : 0;
+}
+
+	/// get a number of locality checks for creating an AD that were answered by the tautology cache of semantic locality
+unsigned long long
+ReasoningKernel :: getCachedLocCheckNumber ( void ) const
+{
+	const SemanticLocalityChecker* LC = dynamic_cast<const SemanticLocalityChecker*>(AD->getLocalityChecker());
+	return LC ? LC->getNCacheHits() : 0;
+}
+
 OntologyBasedModularizer*
 ReasoningKernel :: getModExtractor ( ModuleMethod moduleMethod )
 {
@@ -591,6 +972,8 @@ ReasoningKernel :: getModExtractor ( ModuleMethod moduleMethod )
 	OntologyBasedModularizer*& pMod = getModPointer(moduleMethod);
 	if ( unlikely(pMod == nullptr) )
 		pMod = new OntologyBasedModularizer ( getOntology(), moduleMethod );
+	else	// the modularizer is kept between the changes of the ontology
+		pMod->checkOntology();
 	return pMod;
 }
 
@@ -619,26 +1002,33 @@ ReasoningKernel :: getNonLocal ( ModuleMethod moduleMethod, ModuleType moduleTyp
 		if ( const TNamedEntity* entity = dynamic_cast<const TNamedEntity*>(expr) )
 			Sig.add(entity);
 
-//	TLISPOntologyPrinter lp(std::cout);
 	// do check
 	LocalityChecker* LC = getModExtractor(moduleMethod)->getModularizer()->getLocalityChecker();
 	LC->setSignatureValue(Sig);
 	Result.clear();
-	for ( TDLAxiom* axiom : getOntology() )
-	{
-//		std::cout << "Checking locality of ";
-//		axiom->accept(lp);
-		if ( !LC->local(axiom) )
-		{
-//			std::cout << "AX non-local" << std::endl;
-			Result.push_back(axiom);
-		}
-//		else
-//			std::cout << "AX local" << std::endl;
-	}
+	// check all the axioms at once
+	std::vector<bool> Local;
+	LC->local ( getOntology().getAxioms(), Local );
+	for ( size_t i = 0; i < Local.size(); ++i )
+		if ( !Local[i] )
+			Result.push_back(getOntology().getAxioms()[i]);
 	return Result;
 }
 
+/// get a number of modules wrt given method that were taken from the module cache
+unsigned long long
+ReasoningKernel :: getModuleCacheHitNumber ( ModuleMethod moduleMethod )
+{
+	return getModExtractor(moduleMethod)->getNCacheHits();
+}
+
+/// get a number of locality checks wrt given method that were saved by the module cache
+unsigned long long
+ReasoningKernel :: getSavedLocCheckNumber ( ModuleMethod moduleMethod )
+{
+	return getModExtractor(moduleMethod)->getNSavedChecks();
+}
+
 //----------------------------------------------------------------------------------
 // save/load interface
 //----------------------------------------------------------------------------------
@@ -663,6 +1053,10 @@ ReasoningKernel :: setSaveLoadContext ( const std::string& name )
 bool
 ReasoningKernel :: clearSaveLoadContext ( const std::string& name ) const
 {
+	// saved ADs are cleared together with the state
+	for ( ModuleMethod method : { SYN_LOC_STD, SYN_LOC_COUNT, SEM_LOC } )
+		for ( ModuleType type : { M_TOP, M_BOT, M_STAR } )
+			SaveLoadManager ( name, getADExtension ( method, type ) ).clearContent();
 	if ( checkSaveLoadContext(name) )
 	{
 		SaveLoadManager(name).clearContent();
@@ -784,6 +1178,16 @@ bool ReasoningKernel :: initOptions ( void )
 		) )
 		return true;
 
+	// register "queryCacheSize" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"queryCacheSize",
+		"Option 'queryCacheSize' sets the memory budget (in kilobytes) for the taxonomy positions of the recently "
+		"classified complex queries. The positions are valid until the KB is changed. 0 means no caching.",
+		ifOption::iotInt,
+		"1024"
+		) )
+		return true;
+
 	// register "testTimeout" option -- 21/08/09
 	if ( KernelOptions.RegisterOption (
 		"testTimeout",
@@ -835,6 +1239,59 @@ bool ReasoningKernel :: initOptions ( void )
 		) )
 		return true;
 
+	// register "useTaxonomyIndex" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useTaxonomyIndex",
+		"Option 'useTaxonomyIndex' makes FaCT++ build an index of the finalised concept taxonomy. The index "
+		"answers subsumption between classified concepts and non-direct sub/super-concept queries without "
+		"taxonomy traversal at the cost of extra memory.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "useIndividualBatching" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useIndividualBatching",
+		"Option 'useIndividualBatching' allows FaCT++ to realise individuals that have the same description and "
+		"the same related individuals as an already realised one without any subsumption tests.",
+		ifOption::iotBool,
+		"true"
+		) )
+		return true;
+
+	// register "useInstanceIndex" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useInstanceIndex",
+		"Option 'useInstanceIndex' makes FaCT++ build concept-to-instances lists after realisation, so instance "
+		"queries for named concepts are answered by a lookup at the cost of extra memory.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "useABoxPartitioning" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useABoxPartitioning",
+		"Option 'useABoxPartitioning' makes FaCT++ split the ABox into role-connected components and reason "
+		"over each of them separately: the KB is consistent iff all the components are, and the instance "
+		"tests use the model of the individual's component only. Works only if neither nominals nor the "
+		"universal role are used in concept expressions.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "useCachedBottomUp" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useCachedBottomUp",
+		"Option 'useCachedBottomUp' allows FaCT++ to reject bottom-up candidates by merging their cached "
+		"models with the cached model of the negation of the classified concept, without tableau tests.",
+		ifOption::iotBool,
+		"true"
+		) )
+		return true;
+
 	// options for kernel
 
 	// register "checkAD" option (24/02/2012)
@@ -864,6 +1321,17 @@ bool ReasoningKernel :: initOptions ( void )
 		) )
 		return true;
 
+	// register "useIncrementalABox" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useIncrementalABox",
+		"Option 'useIncrementalABox' allows FaCT++ to add new instance, related and value assertions to the "
+		"loaded KB instead of reloading it. The ABox is re-checked for consistency, and only individuals "
+		"connected to the changed ones are realised again. Works only if no nominals are used in concept expressions.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
 	// register "allowUndefinedNames" option (03/11/2013)
 	if ( KernelOptions.RegisterOption (
 		"allowUndefinedNames",
@@ -33,6 +33,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tOntologyAtom.h"	// types for AD
 #include "ModuleType.h"
 #include "ModuleMethod.h"
+#include "QueryCache.h"
 
 class OntologyBasedModularizer;
 class AtomicDecomposer;
@@ -91,6 +92,26 @@ public:	// types interface
 		// IndividualSet is just set of named individual expressions
 	typedef NamesVector IndividualSet;
 
+	// batch queries
+
+		/// concept expressions of a batch query
+	typedef std::vector<TConceptExpr*> ConceptVec;
+		/// packed answers of a batch query: the answer to the i-th query is the bit (i%8) of the byte i/8
+	typedef std::vector<unsigned char> QueryResultBits;
+
+		/// report about the committed batch of ontology changes
+	struct BatchReport
+	{
+			/// number of added axioms
+		size_t nAdded = 0;
+			/// number of retracted axioms
+		size_t nRetracted = 0;
+			/// number of KB reloads saved: changed versions of the ontology queried during the batch, each of them would be reprocessed otherwise
+		unsigned int nReloadsSaved = 0;
+			/// time of the re-reasoning pass in seconds
+		float time = 0;
+	};
+
 		/// typedef for intermediate instance related type
 	typedef TRelatedMap::CIVec CIVec;
 
@@ -110,6 +131,8 @@ protected:	// types
 	typedef const std::vector<const TDLExpression*> TExprVec;
 		/// names to module signature map
 	typedef TBox::NameSigMap NameSigMap;
+		/// map between an entity and the names whose module signature contains it
+	typedef std::map<const TNamedEntity*, std::set<const TNamedEntity*>> SigNameMap;
 
 private:	// members
 		/// options for the kernel and all related substructures
@@ -136,6 +159,8 @@ protected:	// members
 	TExpressionTranslator* pET = nullptr;
 		/// name-signature map
 	NameSigMap Name2Sig;
+		/// reverse name-signature map
+	SigNameMap Sig2Name;
 		/// ontology signature (used in incremental)
 	TSignature OntoSig;
 		/// trace vector for the last operation (set from the TBox trace-sets)
@@ -144,6 +169,8 @@ protected:	// members
 	KnowledgeExplorer* KE = nullptr;
 		/// atomic decomposer
 	AtomicDecomposer* AD = nullptr;
+		/// module method used by the atomic decomposer
+	ModuleMethod ADMethod = SYN_LOC_STD;
 		/// syntactic locality based module extractor
 	OntologyBasedModularizer* ModSyn = nullptr;
 		/// syntactic with counting locality based module extractor
@@ -191,6 +218,8 @@ protected:	// members
 	TConcept* cachedConcept = nullptr;
 		/// cached query result (taxonomy position)
 	TaxonomyVertex* cachedVertex = nullptr;
+		/// taxonomy positions of the recently classified complex queries
+	QueryCache ClassifiedQueries;
 
 	// internal flags
 
@@ -202,8 +231,16 @@ protected:	// members
 	bool ignoreExprCache = false;
 		/// use incremental reasoning
 	bool useIncrementalReasoning = false;
+		/// add new ABox assertions to the loaded KB instead of reloading it
+	bool useIncrementalABox = false;
 		/// flag to dump LISP-like ontology
 	bool dumpOntology = false;
+		/// set if the ontology changes are collected into a batch
+	bool batchOpen = false;
+		/// report about the current (or the last committed) batch
+	BatchReport LastBatch;
+		/// version of the ontology that was queried last during the batch
+	unsigned long long batchQueryVersion = 0;
 
 protected:	// methods
 
@@ -215,8 +252,8 @@ protected:	// methods
 	{
 		if ( pTBox == nullptr )
 			return kbEmpty;
-		// if the ontology is changed, it needs to be reclassified
-		if ( Ontology.isChanged() )
+		// if the ontology is changed, it needs to be reclassified; changes of an open batch are not visible yet
+		if ( Ontology.isChanged() && !batchOpen )
 			return kbLoading;
 		return pTBox->getStatus();
 	}
@@ -282,10 +319,17 @@ protected:	// methods
 	void setUpSatCache ( DLTree* query );
 		/// set up cache for query, performing additional (re-)classification if necessary
 	void setUpCache ( TConceptExpr* query, cacheStatus level );
+		/// clear query caches when the taxonomy is (re)built
+	void clearClassifiedQueries ( void )
+	{
+		ClassifiedQueries.clear();
+		ClassifiedQueries.setBudget ( 1024 * static_cast<size_t>(getOptions()->getInt("queryCacheSize")) );
+	}
 		/// clear cache and flags
 	void initCacheAndFlags ( void )
 	{
 		clearQueryCache();
+		clearClassifiedQueries();
 		NeedTracing = false;
 	}
 
@@ -336,6 +380,8 @@ protected:	// methods
 	}
 		/// @return true iff C [= D holds
 	bool checkSub ( TConcept* C, TConcept* D );
+		/// @return true iff the taxonomy vertex V is below the named concept D in the classified KB
+	bool isBelow ( TaxonomyVertex* v, TConcept* D );
 		/// helper; @return true iff C is either named concept of Top/Bot
 	static bool isNameOrConst ( const TConceptExpr* C )
 	{
@@ -433,6 +479,10 @@ protected:	// methods
 	const TBox* getTBox ( void ) const { checkTBox(); return pTBox; }
 		/// clear TBox and related structures; keep ontology in place
 	void clearTBox ( void );
+		/// clear AD and modularizers built for the axioms of the ontology
+	void clearModules ( void );
+		/// clear the semantic modularizer and the AD built with it: its reasoner shares the entities with the TBox
+	void clearSemanticModules ( void );
 
 		/// get RW access to Object RoleMaster from TBox
 	RoleMaster& getORM ( void ) { return getTBox()->getORM(); }
@@ -479,6 +529,16 @@ protected:	// methods
 		try { return resolveRole(TreeDeleter(e(r))); }
 		catch(...) { throw EFaCTPlusPlus(reason); }
 	}
+		/// get data value entry by the TDataValueExpr
+	const TDataEntry* getDataValue ( const TDataValueExpr* v, const char* reason )
+	{
+		try
+		{
+			TreeDeleter value(e(v));
+			return static_cast<const TDataEntry*>(static_cast<DLTree*>(value)->Element().getNE());
+		}
+		catch(...) { throw EFaCTPlusPlus(reason); }
+	}
 
 		/// get taxonomy of the property wrt it's name
 	Taxonomy* getTaxonomy ( TRole* R )
@@ -500,6 +560,10 @@ protected:	// methods
 	//-- incremental reasoning support; implementation in Incremental.cpp
 	//----------------------------------------------
 
+		/// add (if ADD) or remove NAME for all the elements of SIG in Sig2Name
+	void indexSig ( const TNamedEntity* name, const TSignature& sig, bool add );
+		/// add to NAMES all the names such that some axiom from [BEGIN,END) is non-local wrt their module signature
+	void addNonLocalNames ( TOntology::iterator begin, TOntology::iterator end, std::set<const TNamedEntity*>& Names );
 		/// setup Name2Sig for a given ENTITY
 	void setupSig ( const TNamedEntity* entity, const AxiomVec& Module );
 		/// setup Name2Sig for a given ENTITY
@@ -508,8 +572,30 @@ protected:	// methods
 	void buildSignature ( const TNamedEntity* entity, const AxiomVec& Module, std::set<const TNamedEntity*>& toProcess );
 		/// initialise the incremental bits on full reload
 	void initIncremental ( void );
+		/// initialise the incremental bits if they were not restored from the saved state
+	void ensureIncremental ( void )
+	{
+		if ( useIncrementalReasoning && !getTBox()->hasNameSigMap() )
+			initIncremental();
+	}
 		/// incrementally classify changes
 	void doIncremental ( void );
+		/// @return the concept name C of the told subsumption C [= D; NULL if AXIOM is not a told subsumption
+	static const TDLConceptName* getToldSubsumptionName ( const TDLAxiom* axiom );
+		/// @return true iff AXIOM is a declaration or a told subsumption of a concept that might be changed in the loaded TBox
+	static bool isTBoxPatch ( TDLAxiom* axiom );
+		/// @return true iff the ontology changes might be made in the loaded TBox; fill the told subsumptions to add in TOLD
+		/// and the concepts (with all their told subsumptions in TOLD) to rebuild in REPLACED
+	bool canPatchTBox ( const TSignature::BaseType& Removed, AxiomVec& Told, TSignature::BaseType& Replaced );
+		/// make the told subsumptions from TOLD in the loaded TBox, rebuilding the REPLACED concepts
+	void patchTBox ( const AxiomVec& Told, const TSignature::BaseType& Replaced );
+		/// @return true iff AXIOM is an assertion that might be added to the loaded KB
+	static bool isABoxAssertion ( const TDLAxiom* axiom );
+		/// add ABox assertion AXIOM to the loaded KB; @return false if the KB has to be reloaded
+	bool addABoxAssertion ( const TDLAxiom* axiom );
+		/// add new ABox assertions to the loaded KB, reloading it if the update fails halfway;
+		/// @return false if nothing was changed and the KB has to be reloaded
+	bool updateABox ( void );
 
 	//----------------------------------------------
 	//-- save/load support; implementation in SaveLoad.cpp
@@ -531,6 +617,10 @@ protected:	// methods
 	void LoadKB ( SaveLoadManager& m );
 		/// load incremental
 	void LoadIncremental ( SaveLoadManager& m );
+		/// save the AD built using METHOD and TYPE in the S/L context
+	void SaveAD ( ModuleMethod moduleMethod, ModuleType moduleType );
+		/// load the AD for METHOD and TYPE from the S/L context. @return true if succeed
+	bool LoadAD ( ModuleMethod moduleMethod, ModuleType moduleType );
 		/// save internal state of the Kernel to a file NAME
 	void Save ( SaveLoadManager& m );
 		/// load internal state of the Kernel from a file NAME
@@ -632,6 +722,8 @@ public:		// interface
 	void setIgnoreExprCache ( bool value ) { ignoreExprCache = value; }
 		/// choose whether incremental reasoning should be used
 	void setUseIncrementalReasoning ( bool value ) { useIncrementalReasoning = value; }
+		/// choose whether new ABox assertions should be added to the loaded KB
+	void setUseIncrementalABox ( bool value ) { useIncrementalABox = value; }
 		/// set the signature of the expression translator
 	void setSignature ( const TSignature* sig ) { if ( pET != nullptr ) pET->setSignature(sig); }
 		/// choose whether the loaded ontology should be dumped as a LISP one
@@ -686,6 +778,8 @@ public:
 	bool releaseKB ( void )
 	{
 		clearTBox();
+		// the axioms are deleted, so the modules of them are not valid anymore
+		clearModules();
 		Ontology.clear();
 		// the new KB is coming so the failures of the precious one doesn't matter
 		reasoningFailed = false;
@@ -818,6 +912,28 @@ public:
 		/// retract an axiom
 	void retract ( TDLAxiom* axiom ) { Ontology.retract(axiom); }
 
+	//----------------------------------------------------
+	//	batch updates
+	//----------------------------------------------------
+
+		/// start collecting ontology changes into a batch; queries would use the last committed KB until the batch is committed
+	void beginBatch ( void );
+		/// validate changes of the batch and process them in one go; @return the report about the batch.
+		/// If the validation fails then the bad retractions are cancelled and the batch stays open
+	const BatchReport& commitBatch ( void );
+		/// @return the report about the last committed batch
+	const BatchReport& getBatchReport ( void ) const { return LastBatch; }
+		/// @return true iff there is an open batch of changes
+	bool isBatchOpen ( void ) const { return batchOpen; }
+
+	//----------------------------------------------------
+	//	bulk loading
+	//----------------------------------------------------
+
+		/// add all the axioms from the stream of NCODES CODES (see AxiomStreamCodes.h) that refers to the NAMES;
+		/// append the added axioms to AXIOMS. The axioms read before an error in the stream stay in the ontology and in AXIOMS
+	void loadAxiomStream ( const int* codes, size_t nCodes, const std::vector<const char*>& Names, AxiomVec& Axioms );
+
 	//******************************************
 	//* ASK part
 	//******************************************
@@ -831,6 +947,12 @@ public:
 		/// return consistency status of KB
 	bool isKBConsistent ( void )
 	{
+		// the changed ontology is not reprocessed during the batch
+		if ( batchOpen && Ontology.isChanged() && batchQueryVersion != Ontology.getVersion() )
+		{
+			batchQueryVersion = Ontology.getVersion();
+			++LastBatch.nReloadsSaved;
+		}
 		try {
 			if ( getStatus() <= kbLoading )
 				processKB(kbCChecked);
@@ -1072,6 +1194,10 @@ public:
 		DLTree* nD = createSNFNot(e(D));
 		return !checkSatTree ( createSNFAnd (e(C), nD) );
 	}
+		/// set the i-th bit of RESULT iff C[i] is satisfiable
+	void isSatisfiable ( const ConceptVec& C, QueryResultBits& Result );
+		/// set the i-th bit of RESULT iff C[i] [= D[i] holds
+	void isSubsumedBy ( const ConceptVec& C, const ConceptVec& D, QueryResultBits& Result );
 		/// @return true iff C is disjoint with D; that is, (C and D) is unsatisfiable
 	bool isDisjoint ( const TConceptExpr* C, const TConceptExpr* D ) { return !isSatisfiable(getExpressionManager()->And(C,D)); }
 		/// @return true iff C is equivalent to D
@@ -1143,6 +1269,12 @@ public:
 		tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/false> ( cachedVertex, actor );
 	}
 
+		/// export the concept taxonomy in the flat form. Only vertices with named concepts are exported; they are
+		/// numbered from 0, which is BOTTOM; 1 is TOP. Parents of a vertex are the closest exported vertices above it.
+		/// STRUCTURE is the number of vertices followed by the number of names, the number of direct parents and
+		/// the parent numbers of every vertex. NAMES are the names of vertex 0, then the names of vertex 1, etc.
+	void getConceptTaxonomy ( NamesVector& Names, std::vector<unsigned int>& Structure );
+
 	// role hierarchy
 
 		/// apply actor::apply() to all DIRECT super-roles of [complex] R
@@ -1224,6 +1356,14 @@ public:
 		setUpCache ( C, csClassified );
 		actor.clear();
 
+		// realised KB with posting lists -- just look them up
+		const InstanceIndex* index = getTBox()->getInstanceIndex();
+		if ( index != nullptr && index->isIndexed(cachedVertex) )
+		{
+			index->getDirectInstances ( cachedVertex, actor );
+			return;
+		}
+
 		// implement 1-level check by hand
 
 		// if the root vertex contains individuals -- we are done
@@ -1244,6 +1384,12 @@ public:
 		realiseKB();	// ensure KB is ready to answer the query
 		setUpCache ( C, csClassified );
 		actor.clear();
+		const InstanceIndex* index = getTBox()->getInstanceIndex();
+		if ( index != nullptr && index->isIndexed(cachedVertex) )
+		{
+			index->getInstances ( cachedVertex, actor );
+			return;
+		}
 		Taxonomy* tax = getCTaxonomy();
 		tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/false> ( cachedVertex, actor );
 	}
@@ -1295,6 +1441,10 @@ public:
 
 		/// set RESULT into set of individuals such that they do have data roles R and S, and R op S
 	void getDataRelatedIndividuals ( TDRoleExpr* R, TDRoleExpr* S, int op, IndividualSet& Result );
+		/// set RESULT into set of individuals I such that A(I,v) holds for some V in [MIN,MAX]; NULL bound is open;
+		/// MINEXCL/MAXEXCL make the corresponding bound exclusive. Only the told data assertions are used
+	void getDataValueInstances ( TDRoleExpr* A, TDataValueExpr* Min, bool minExcl, TDataValueExpr* Max, bool maxExcl,
+								 IndividualSet& Result );
 
 	//----------------------------------------------------------------------------------
 	// knowledge exploration queries
@@ -1326,7 +1476,8 @@ public:
 	// atomic decomposition queries
 	//----------------------------------------------------------------------------------
 
-		/// create new atomic decomposition of the loaded ontology using TYPE. @return size of the AD
+		/// create new atomic decomposition of the loaded ontology using TYPE; reuse the one saved in S/L context if possible.
+		/// Existing AD for the same method and type is updated wrt ontology changes. @return size of the AD
 	size_t getAtomicDecompositionSize ( ModuleMethod moduleMethod, ModuleType moduleType );
 		/// get a set of axioms that corresponds to the atom with the id INDEX
 	const TOntologyAtom::AxiomSet& getAtomAxioms ( unsigned int index ) const;
@@ -1336,6 +1487,10 @@ public:
 	const TOntologyAtom::AtomSet& getAtomDependents ( unsigned int index ) const;
 		/// get a number of locality checks performed for creating an AD
 	unsigned long long getLocCheckNumber ( void ) const;
+		/// get a number of locality checks for creating an AD that were answered by the syntactic pre-check of semantic locality
+	unsigned long long getSynLocCheckNumber ( void ) const;
+		/// get a number of locality checks for creating an AD that were answered by the tautology cache of semantic locality
+	unsigned long long getCachedLocCheckNumber ( void ) const;
 
 	//----------------------------------------------------------------------------------
 	// modularity queries
@@ -1345,6 +1500,21 @@ public:
 	const AxiomVec& getModule ( ModuleMethod moduleMethod, ModuleType moduleType );
 		/// get a set of non-local axioms of an ontology wrt given method.
 	const AxiomVec& getNonLocal ( ModuleMethod moduleMethod, ModuleType moduleType );
+		/// get a number of modules wrt given method that were taken from the module cache
+	unsigned long long getModuleCacheHitNumber ( ModuleMethod moduleMethod );
+		/// get a number of locality checks wrt given method that were saved by the module cache
+	unsigned long long getSavedLocCheckNumber ( ModuleMethod moduleMethod );
+
+	//----------------------------------------------------------------------------------
+	// query cache statistics
+	//----------------------------------------------------------------------------------
+
+		/// get a number of complex queries whose taxonomy position was taken from the query cache
+	unsigned long long getQueryCacheHitNumber ( void ) const { return ClassifiedQueries.getNHits(); }
+		/// get a number of complex queries that were classified as they were not in the query cache
+	unsigned long long getQueryCacheMissNumber ( void ) const { return ClassifiedQueries.getNMisses(); }
+		/// get a number of queries removed from the query cache to fit the memory budget
+	unsigned long long getQueryCacheEvictionNumber ( void ) const { return ClassifiedQueries.getNEvictions(); }
 
 	//----------------------------------------------------------------------------------
 	// save/load interface
@@ -20,6 +20,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 // locality checking
 #include "SemanticLocalityChecker.h"
 #include "SyntacticLocalityChecker.h"
+#include "CompiledLocalityChecker.h"
 #include "ExtendedSyntacticLocalityChecker.h"
 
 /// @return a locality checker corresponding to a given method
@@ -27,8 +28,8 @@ LocalityChecker* createLocalityChecker ( ModuleMethod moduleMethod, TSignature*
 {
 	switch ( moduleMethod )
 	{
-	case SYN_LOC_STD: return new SyntacticLocalityChecker(pSig);
-	case SYN_LOC_COUNT: return new ExtendedSyntacticLocalityChecker(pSig);
+	case SYN_LOC_STD: return new CompiledLocalityChecker(pSig);
+	case SYN_LOC_COUNT: return new CompiledExtendedLocalityChecker(pSig);
 	case SEM_LOC: return new SemanticLocalityChecker(pSig);
 	default: fpp_unreachable();
 	}
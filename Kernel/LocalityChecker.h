@@ -67,10 +67,17 @@ public:		// interface
 	explicit LocalityChecker ( const TSignature* s ) : SigAccessor(s) {}
 
 		/// @return true iff an AXIOM is local wrt signature
-	bool local ( const TDLAxiom* axiom )
+	virtual bool local ( const TDLAxiom* axiom )
 	{
 		axiom->accept(*this);
 		return isLocal;
+	}
+		/// fill LOCAL with the locality values of all AXIOMS wrt signature
+	virtual void local ( const AxiomVec& Axioms, std::vector<bool>& Local )
+	{
+		Local.resize(Axioms.size());
+		for ( size_t i = 0; i < Axioms.size(); ++i )
+			Local[i] = local(Axioms[i]);
 	}
 		/// fake method to match the semantic checker's interface
 	virtual void preprocessOntology ( const AxiomVec& ) {}
@@ -113,14 +113,17 @@ protected:	// methods
 			if ( !axiom->isInModule() && axiom->isInSS() ) // in the given range but not in module yet
 				addNonLocal ( axiom, noCheck );
 	}
-		/// build a module traversing axioms by a signature
-	void extractModuleQueue ( void )
+		/// build a module traversing axioms by a signature; axioms from SEED (if given) are known to be in the module
+	void extractModuleQueue ( const AxiomVec* Seed )
 	{
 		// init queue with a sig
 		for ( const TNamedEntity* entity : sig )
 			WorkQueue.push(entity);
 		// add all the axioms that are non-local wrt given value of a top-locality
 		addNonLocal ( sigIndex.getNonLocal(sig.topCLocal()), /*noCheck=*/true );
+		// add all the known module axioms
+		if ( Seed != nullptr )
+			addNonLocal ( *Seed, /*noCheck=*/true );
 		// main cycle
 		while ( !WorkQueue.empty() )
 		{
@@ -130,8 +133,8 @@ protected:	// methods
 			addNonLocal ( sigIndex.getAxioms(entity), /*noCheck=*/false );
 		}
 	}
-		/// extract module wrt presence of a sig index
-	void extractModule ( const_iterator begin, const_iterator end )
+		/// extract module wrt presence of a sig index; use axioms from SEED (if given) without checking
+	void extractModule ( const_iterator begin, const_iterator end, const AxiomVec* Seed = nullptr )
 	{
 		size_t size = (size_t)(end-begin);
 		Module.clear();
@@ -143,7 +146,7 @@ protected:	// methods
 		for ( p = begin; p != end; ++p )
 			if ( (*p)->isUsed() )
 				(*p)->setInSS(true);
-		extractModuleQueue();
+		extractModuleQueue(Seed);
 		for ( p = begin; p != end; ++p )
 			(*p)->setInSS(false);
 	}
@@ -165,14 +168,15 @@ public:		// interface
 		sigIndex.preprocessOntology(vec);
 		nChecks += 2*vec.size();
 	}
-		/// extract module wrt SIGNATURE and TYPE from the set of axioms [BEGIN,END)
-	void extract ( const_iterator begin, const_iterator end, const TSignature& signature, ModuleType type )
+		/// extract module wrt SIGNATURE and TYPE from the set of axioms [BEGIN,END).
+		/// SEED, if given, is a subset of the module (eg, a module for a smaller signature); it is used for BOT and TOP modules only
+	void extract ( const_iterator begin, const_iterator end, const TSignature& signature, ModuleType type, const AxiomVec* Seed = nullptr )
 	{
 		bool topLocality = (type == M_TOP);
 
 		sig = signature;
 		sig.setLocality(topLocality);
- 		extractModule ( begin, end );
+ 		extractModule ( begin, end, type == M_STAR ? nullptr : Seed );
 
 		if ( type != M_STAR )
 			return;
@@ -192,8 +196,8 @@ public:		// interface
 		} while ( size != Module.size() );
 	}
 		/// extract module wrt SIGNATURE and TYPE from the axiom vector VEC
-	void extract ( const AxiomVec& Vec, const TSignature& signature, ModuleType type )
-		{ extract ( Vec.begin(), Vec.end(), signature, type ); }
+	void extract ( const AxiomVec& Vec, const TSignature& signature, ModuleType type, const AxiomVec* Seed = nullptr )
+		{ extract ( Vec.begin(), Vec.end(), signature, type, Seed ); }
 		/// extract module wrt SIGNATURE and TYPE from O
 	void extract ( const TOntology& O, const TSignature& signature, ModuleType type )
 		{ extract ( O.getAxioms(), signature, type ); }
@@ -212,6 +216,16 @@ public:		// interface
  		return Checker->local(ax);
 	}
 
+		/// @return true iff the axiom AX is non-local wrt SIGNATURE and TYPE (BOT or TOP)
+	bool isNonLocal ( TDLAxiom* ax, const TSignature& signature, ModuleType type )
+	{
+		sig = signature;
+		sig.setLocality(type == M_TOP);
+		return isNonLocal(ax);
+	}
+		/// @return true iff the axiom AX is non-local wrt the empty signature, ie, it is in every module of type TYPE (BOT or TOP)
+	bool isInAllModules ( TDLAxiom* ax, ModuleType type ) { return isNonLocal ( ax, TSignature(), type ); }
+
 		/// get RW access to the sigIndex (mainly to (un-)register axioms on the fly)
 	SigIndex* getSigIndex ( void ) { return &sigIndex; }
 
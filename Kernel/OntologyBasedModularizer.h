@@ -20,21 +20,92 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef ONTOLOGYBASEDMODULARIZER_H
 #define ONTOLOGYBASEDMODULARIZER_H
 
+#include <list>
+#include <map>
+#include <algorithm>
+
 #include "Modularity.h"
 #include "tOntology.h"
 
 class OntologyBasedModularizer
 {
+protected:	// types
+		/// key of the module cache: module type and a (sorted) signature
+	typedef std::pair<ModuleType, TSignature::BaseType> CacheKey;
+		/// list of cache keys; the most recently used first
+	typedef std::list<const CacheKey*> LRUList;
+		/// entry of the module cache
+	struct CacheEntry
+	{
+			/// the module
+		AxiomVec Module;
+			/// number of locality checks made to build the module
+		unsigned long long nChecks;
+			/// position of an entry in the LRU list
+		LRUList::iterator pos;
+	};
+		/// module cache itself
+	typedef std::map<CacheKey, CacheEntry> ModuleCache;
+
 protected:	// members
 		/// ontology to work with
 	const TOntology& Ontology;
 		/// pointer to a modularizer
 	TModularizer* Modularizer;
+		/// cached modules of the whole ontology
+	ModuleCache Cache;
+		/// LRU order of the cached modules
+	LRUList LRU;
+		/// version of the ontology the modularizer was prepared for
+	unsigned long long version;
+		/// max number of modules in cache
+	size_t maxCacheSize = 64;
+		/// number of modules taken from the cache
+	unsigned long long nCacheHits = 0;
+		/// number of locality checks saved by cache
+	unsigned long long nSavedChecks = 0;
+
+protected:	// methods
+		/// clear the module cache
+	void clearCache ( void )
+	{
+		Cache.clear();
+		LRU.clear();
+	}
+		/// @return the largest cached module of type TYPE for a subset of a signature SIG; @return NULL if there is no such
+	const AxiomVec* findSubsetModule ( ModuleType type, const TSignature::BaseType& sig ) const
+	{
+		const AxiomVec* ret = nullptr;
+		for ( const auto& entry: Cache )
+			if ( entry.first.first == type && entry.first.second.size() < sig.size() &&
+				 ( ret == nullptr || entry.second.Module.size() > ret->size() ) &&
+				 std::includes ( sig.begin(), sig.end(), entry.first.second.begin(), entry.first.second.end() ) )
+				ret = &entry.second.Module;
+		return ret;
+	}
+		/// put the last built MODULE for KEY that took NCHECKS locality checks into the cache; @return cached module
+	const AxiomVec& addToCache ( const CacheKey& key, const AxiomVec& Module, unsigned long long nChecks )
+	{
+		if ( unlikely(maxCacheSize == 0) )	// no cache
+			return Module;
+		if ( Cache.size() >= maxCacheSize )
+		{	// remove the least recently used module
+			Cache.erase(*LRU.back());
+			LRU.pop_back();
+		}
+		ModuleCache::iterator p = Cache.insert ( std::make_pair ( key, CacheEntry() ) ).first;
+		p->second.Module = Module;
+		p->second.nChecks = nChecks;
+		LRU.push_front(&p->first);
+		p->second.pos = LRU.begin();
+		return p->second.Module;
+	}
 
 public:		// interface
 		/// init c'tor
 	OntologyBasedModularizer ( const TOntology& ontology, ModuleMethod moduleMethod )
 		: Ontology(ontology)
+		, version(ontology.getVersion())
 	{
 		Modularizer = new TModularizer(moduleMethod);
 		Modularizer->preprocessOntology(Ontology.getAxioms());
@@ -42,17 +113,57 @@ public:		// interface
 		/// d'tor
 	~OntologyBasedModularizer() { delete Modularizer; }
 
+		/// make sure that the modularizer and the cache corresponds to the current ontology
+	void checkOntology ( void )
+	{
+		if ( likely(version == Ontology.getVersion()) )
+			return;
+		version = Ontology.getVersion();
+		clearCache();
+		Modularizer->preprocessOntology(Ontology.getAxioms());
+	}
+
 		/// get module
 	const AxiomVec& getModule ( const AxiomVec& From, const TSignature& sig, ModuleType type )
 	{
 		Modularizer->extract ( From, sig, type );
 		return Modularizer->getModule();
 	}
-		/// get module
+		/// get module of the whole ontology; use cached modules if possible
 	const AxiomVec& getModule ( const TSignature& sig, ModuleType type )
-		{ return getModule ( Ontology.getAxioms(), sig, type ); }
+	{
+		checkOntology();
+		CacheKey key ( type, TSignature::BaseType ( sig.begin(), sig.end() ) );
+		ModuleCache::iterator p = Cache.find(key);
+		if ( p != Cache.end() )
+		{
+			++nCacheHits;
+			nSavedChecks += p->second.nChecks;
+			LRU.splice ( LRU.begin(), LRU, p->second.pos );
+			return p->second.Module;
+		}
+		// modules are monotone in signature, so module for a smaller signature is a part of a new one
+		const AxiomVec* Seed = type == M_STAR ? nullptr : findSubsetModule ( type, key.second );
+		// every axiom from the seed would need at least one check
+		if ( Seed != nullptr )
+			nSavedChecks += Seed->size();
+		unsigned long long nChecks = Modularizer->getNChecks();
+		Modularizer->extract ( Ontology.getAxioms(), sig, type, Seed );
+		return addToCache ( key, Modularizer->getModule(), Modularizer->getNChecks()-nChecks );
+	}
 		/// get access to a modularizer
 	TModularizer* getModularizer ( void ) { return Modularizer; }
+
+		/// set the max number of cached modules to SIZE
+	void setCacheSize ( size_t size )
+	{
+		maxCacheSize = size;
+		clearCache();
+	}
+		/// get number of modules taken from cache
+	unsigned long long getNCacheHits ( void ) const { return nCacheHits; }
+		/// get number of locality checks saved by cache
+	unsigned long long getNSavedChecks ( void ) const { return nSavedChecks; }
 }; // OntologyBasedModularizer
 
 #endif
@@ -573,3 +573,30 @@ void TBox::RemoveExtraDescriptions ( void )
 	std::for_each ( i_begin(), i_end(), removeDescription );
 }
 
+
+void
+TBox :: preprocessUpdatedIndividual ( TIndividual* I )
+{
+	if ( isValid(I->pName) )
+	{	// known individual: told subsumers are still valid, but it is not CD anymore
+		I->setCompletelyDefined(false);
+		I->classTag = cttUnspecified;
+		I->getClassTag();
+		return;
+	}
+
+	// fresh individual: do the same preprocessing as for the loaded ones
+	replaceSynonymsFromTree(I->Description);
+	I->initToldSubsumers();
+	I->setToldTop(pTop);
+	I->calculateTSDepth();
+
+	// the last index is reserved for the query concept; move it further
+	I->setIndex(nC-1);
+	ConceptMap.push_back(I);
+	++nC;
+
+	addConceptToHeap(I);
+	I->getClassTag();
+	I->removeDescription();
+}
@@ -0,0 +1,109 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <ostream>
+
+#include "QueryCache.h"
+#include "taxVertex.h"
+
+void
+QueryCache :: release ( const Entry& e )
+{
+	if ( e.Own )
+		delete e.Vertex;
+}
+
+void
+QueryCache :: evict ( void )
+{
+	const Entry& e = Entries.back();
+	Used -= e.Size;
+	Index.erase(e.Query);
+	release(e);
+	Entries.pop_back();
+	++nEvictions;
+}
+
+void
+QueryCache :: setBudget ( size_t budget )
+{
+	Budget = budget;
+	while ( Used > Budget )
+		evict();
+}
+
+TaxonomyVertex*
+QueryCache :: get ( const TDLConceptExpression* query )
+{
+	EntryMap::iterator p = Index.find(query);
+	if ( p == Index.end() )
+	{
+		++nMisses;
+		return nullptr;
+	}
+	++nHits;
+	// move the entry to the front of the LRU list
+	Entries.splice ( Entries.begin(), Entries, p->second );
+	return p->second->Vertex;
+}
+
+void
+QueryCache :: add ( const TDLConceptExpression* query, TaxonomyVertex* v, bool own )
+{
+	size_t size = sizeof(Entry) + sizeof(EntryMap::value_type) + 4*sizeof(void*);
+	if ( own )
+		size += sizeof(TaxonomyVertex) + sizeof(TaxonomyVertex*) *
+			( (v->end(true) - v->begin(true)) + (v->end(false) - v->begin(false)) );
+
+	if ( size > Budget || Index.count(query) > 0 )
+		return;
+	while ( Used + size > Budget )
+		evict();
+
+	if ( own )
+	{	// the temporary vertex will be re-used by the next query, so keep its neighbours only
+		TaxonomyVertex* copy = new TaxonomyVertex();
+		copy->setSample ( v->getPrimer(), /*linkBack=*/false );
+		for ( bool upDirection : { true, false } )
+			for ( TaxonomyVertex::iterator p = v->begin(upDirection), p_end = v->end(upDirection); p != p_end; ++p )
+				copy->addNeighbour ( upDirection, *p );
+		v = copy;
+	}
+
+	Entries.push_front ( Entry { query, v, own, size } );
+	Index[query] = Entries.begin();
+	Used += size;
+}
+
+void
+QueryCache :: clear ( void )
+{
+	for ( const Entry& e: Entries )
+		release(e);
+	Entries.clear();
+	Index.clear();
+	Used = 0;
+}
+
+void
+QueryCache :: print ( std::ostream& o ) const
+{
+	o << "Query cache: " << Entries.size() << " entries in " << Used << " bytes; " << nHits << " hits, "
+	  << nMisses << " misses, " << nEvictions << " evictions\n";
+}
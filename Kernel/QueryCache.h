@@ -0,0 +1,106 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <iosfwd>
+
+#include "tDLExpression.h"
+
+class TaxonomyVertex;
+
+/// LRU cache of the taxonomy positions of the classified complex queries.
+/// The positions refer to the vertices of the concept taxonomy, so the cache should be cleared whenever the taxonomy changes.
+class QueryCache
+{
+protected:	// types
+		/// cached position of a single query
+	struct Entry
+	{
+			/// query expression (shared by the expression manager)
+		const TDLConceptExpression* Query;
+			/// taxonomy position of the query
+		TaxonomyVertex* Vertex;
+			/// true iff the Vertex is a copy owned by the cache
+		bool Own;
+			/// approximate memory used by the entry
+		size_t Size;
+	};
+		/// entries in the LRU order: most recent first
+	typedef std::list<Entry> EntryList;
+		/// map from a query to its entry
+	typedef std::unordered_map<const TDLConceptExpression*, EntryList::iterator> EntryMap;
+
+protected:	// members
+		/// LRU list of the entries
+	EntryList Entries;
+		/// index of the entries
+	EntryMap Index;
+		/// memory budget in bytes; 0 means no caching
+	size_t Budget = 0;
+		/// memory used by the entries
+	size_t Used = 0;
+		/// number of queries found in the cache
+	unsigned long long nHits = 0;
+		/// number of queries not found in the cache
+	unsigned long long nMisses = 0;
+		/// number of entries removed to fit the budget
+	unsigned long long nEvictions = 0;
+
+protected:	// methods
+		/// remove the least recently used entry
+	void evict ( void );
+		/// delete the copy of the vertex of the entry E (if any)
+	static void release ( const Entry& e );
+
+public:		// interface
+		/// empty c'tor
+	QueryCache() = default;
+		/// no copy c'tor
+	QueryCache ( const QueryCache& ) = delete;
+		/// no assignment
+	QueryCache& operator = ( const QueryCache& ) = delete;
+		/// d'tor
+	~QueryCache() { clear(); }
+
+		/// set the memory budget to BUDGET bytes; evict entries that do not fit
+	void setBudget ( size_t budget );
+		/// @return the taxonomy position of QUERY if it is cached; NULL otherwise
+	TaxonomyVertex* get ( const TDLConceptExpression* query );
+		/// remember the position V of QUERY. If OWN is true then V is a temporary vertex whose copy is stored
+	void add ( const TDLConceptExpression* query, TaxonomyVertex* v, bool own );
+		/// remove all the entries; keep the statistics
+	void clear ( void );
+
+	// statistics
+
+		/// @return number of queries found in the cache
+	unsigned long long getNHits ( void ) const { return nHits; }
+		/// @return number of queries not found in the cache
+	unsigned long long getNMisses ( void ) const { return nMisses; }
+		/// @return number of entries removed to fit the budget
+	unsigned long long getNEvictions ( void ) const { return nEvictions; }
+		/// print the cache statistics
+	void print ( std::ostream& o ) const;
+}; // QueryCache
+
+#endif
@@ -33,10 +33,25 @@ RAStateTransitions :: finalise ( RAState state, size_t nRoles, bool data )
 {
 	from = state;
 	DataRole = data;
-	ApplicableRoles.ensureMaxSetSize(nRoles);
-	// fills the set of recognisable roles
+	// collect (role, final state) pairs in the order of transitions
+	std::vector<std::pair<unsigned int, RAState>> RoleSucc;
 	for ( const auto& trans: Base )
-		std::for_each ( trans.begin(), trans.end(), [&] (const TRole* R) { ApplicableRoles.add(R->getIndex()); } );
+		for ( const TRole* R: trans )
+			RoleSucc.emplace_back ( R->getIndex(), trans.final() );
+	std::stable_sort ( RoleSucc.begin(), RoleSucc.end(),
+		[] ( const std::pair<unsigned int, RAState>& p1, const std::pair<unsigned int, RAState>& p2 ) { return p1.first < p2.first; } );
+	// build the role->successors table
+	Successors.clear();
+	RoleStart.assign ( nRoles+1, 0 );
+	auto p = RoleSucc.cbegin(), p_end = RoleSucc.cend();
+	for ( unsigned int i = 0; i < nRoles; ++i )
+	{
+		RoleStart[i] = (unsigned int)Successors.size();
+		for ( ; p != p_end && p->first == i; ++p )
+			if ( std::find ( Successors.begin()+RoleStart[i], Successors.end(), p->second ) == Successors.end() )
+				Successors.push_back(p->second);
+	}
+	RoleStart[nRoles] = (unsigned int)Successors.size();
 }
 
 /// add information from TRANS to existing transition between the same states. @return false if no such transition found
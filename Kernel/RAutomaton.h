@@ -20,11 +20,11 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef RAUTOMATON_H
 #define RAUTOMATON_H
 
+#include <algorithm>
 #include <vector>
 #include <iosfwd>
 
 #include "fpp_assert.h"
-#include "tFastSet.h"
 
 class TRole;
 
@@ -113,12 +113,16 @@ protected:	// types
 public:		// type interface
 		/// RO iterators
 	typedef RTBase::const_iterator const_iterator;
+		/// RO iterators over the successor states
+	typedef std::vector<RAState>::const_iterator succ_iterator;
 
 protected:	// members
 		/// all transitions
 	RTBase Base;
-		/// set of all roles that can be applied by one of the transitions
-	TFastSet<unsigned int> ApplicableRoles;
+		/// final states of the transitions applicable to a role, grouped by the role index
+	std::vector<RAState> Successors;
+		/// successors of the role with index I are [RoleStart[I],RoleStart[I+1]) in Successors
+	std::vector<unsigned int> RoleStart;
 		/// state from which all the transition starts
 	RAState from;
 		/// check whether there is an empty transition going from this state
@@ -172,6 +176,10 @@ public:		// interface
 	RAState getFrom ( void ) const { return from; }
 		/// check whether one of the transitions accept R; implementation is in tRole.h
 	bool recognise ( const TRole* R ) const;
+		/// @return begin of the final states of all the transitions applicable to the role with the index I
+	succ_iterator succ_begin ( unsigned int i ) const { return Successors.begin() + RoleStart[i]; }
+		/// @return end of the final states of all the transitions applicable to the role with the index I
+	succ_iterator succ_end ( unsigned int i ) const { return Successors.begin() + RoleStart[i+1]; }
 		/// @return true iff there is only one transition
 	bool isSingleton ( void ) const { return Base.size() == 1; }
 		/// @return final state of the 1st transition; used for singletons
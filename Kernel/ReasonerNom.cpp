@@ -101,6 +101,23 @@ NominalReasoner :: consistentNominalCloud ( void )
 	return true;
 }
 
+bool
+NominalReasoner :: recheckNominalCloud ( void )
+{
+	// caches of the old nominals are built wrt the old ABox
+	for ( auto& ind: Nominals )
+	{
+		delete DLHeap.getCache(ind->pName);
+		DLHeap.setCache ( ind->pName, nullptr );
+	}
+
+	// start from scratch: the old barrier contains the old cloud
+	DlSatTester::prepareReasoner();
+	nonDetShift = 0;
+	initNominalVector();
+	return consistentNominalCloud();
+}
+
 /// create nominal nodes for all individuals in TBox
 bool
 NominalReasoner :: initNominalCloud ( void )
@@ -112,7 +129,7 @@ NominalReasoner :: initNominalCloud ( void )
 
 	// create edges between related nodes
 	for ( TBox::RelatedCollection::const_iterator q = tBox.RelatedI.begin(); q != tBox.RelatedI.end(); ++q, ++q )
-		if ( initRelatedNominals(*q) )
+		if ( isInCloud(resolveSynonym((*q)->a)) && initRelatedNominals(*q) )
 			return true;	// ABox is inconsistent
 
 	// create disjoint markers on nominal nodes
@@ -123,6 +140,9 @@ NominalReasoner :: initNominalCloud ( void )
 
 	for ( const auto& di: tBox.Different )
 	{
+		// different individuals are always in the same component
+		if ( di.empty() || !isInCloud(resolveSynonym(di.front())) )
+			continue;
 		CGraph.initIR();
 		for ( const auto& ind: di )
 			if ( CGraph.setCurIR ( resolveSynonym(ind)->node, dummy ) )	// different(c,c)
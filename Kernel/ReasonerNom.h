@@ -29,8 +29,10 @@ protected:	// type definition
 	typedef TBox::SingletonVector SingletonVector;
 
 protected:	// members
-		/// all nominals defined in TBox
+		/// nominals of the cloud: all the ones defined in TBox or the ones of an ABox part
 	SingletonVector Nominals;
+		/// nominals of the ABox part being checked; empty if the whole ABox is checked
+	std::set<const TIndividual*> Component;
 
 protected:	// methods
 		/// prepare reasoning
@@ -44,6 +46,8 @@ protected:	// methods
 
 		/// init vector of nominals defined in TBox
 	void initNominalVector ( void );
+		/// @return true iff the nominal IND is a part of the cloud being checked
+	bool isInCloud ( const TIndividual* ind ) const { return Component.empty() || Component.count(ind) > 0; }
 
 		/// create cache entry for given singleton
 	void registerNominalCache ( const TIndividual* p )
@@ -81,9 +85,20 @@ public:
 	{
 		initNominalVector();
 	}
+		/// c'tor for the reasoner over the independent ABox part PART only
+	NominalReasoner ( TBox& tbox, const SingletonVector& part )
+		: DlSatTester(tbox)
+		, Nominals(part)
+		, Component(part.begin(), part.end())
+		{}
+
+		/// get the nominals of the cloud
+	const SingletonVector& getNominals ( void ) const { return Nominals; }
 
 		/// check whether ontology with nominals is consistent
 	bool consistentNominalCloud ( void );
+		/// re-check the whole nominal cloud after the ABox update; rebuild caches of all nominals
+	bool recheckNominalCloud ( void );
 }; // NominalReasoner
 
 //-----------------------------------------------------------------------------
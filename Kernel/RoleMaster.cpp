@@ -236,9 +236,13 @@ void RoleMaster :: initAncDesc ( void )
 			TaxCreator.classifyEntry(*p);
 
 	// stage 3: fills ancestor/descendants using taxonomy
+	AncMatrix.init(nRoles);
 	for ( p = p_begin; p != p_end; ++p )
 		if ( !(*p)->isSynonym() )
-			(*p)->initADbyTaxonomy ( pTax, nRoles );
+			(*p)->initADbyTaxonomy ( pTax, AncMatrix.row((*p)->getIndex()) );
+	// TOP and BOTTOM are not in the hierarchy; row 0 is not used by any role, so it is empty
+	universalRole.AncRow = AncMatrix.row(0);
+	emptyRole.AncRow = AncMatrix.row(0);
 
 	// complete role automaton's info
 	for ( p = p_begin; p != p_end; ++p )
@@ -275,6 +279,15 @@ void RoleMaster :: initAncDesc ( void )
 		if ( !(*p)->isSynonym() )
 			(*p)->postProcess();
 
+	// init disjoint roles maps
+	if ( !DJRolesA.empty() )
+	{
+		DJMatrix.init(nRoles);
+		for ( p = p_begin; p != p_end; ++p )
+			if ( !(*p)->isSynonym() && (*p)->isDisjoint() )
+				(*p)->initDJMap(DJMatrix.row((*p)->getIndex()));
+	}
+
 	// the last stage: check whether all roles are consistent
 	for ( p = p_begin; p != p_end; ++p )
 		if ( !(*p)->isSynonym() )
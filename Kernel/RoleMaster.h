@@ -54,6 +54,10 @@ protected:	// members
 
 		/// two halves of disjoint roles axioms
 	TRoleVec DJRolesA, DJRolesB;
+		/// ancestors of all the roles, including roles themselves
+	TRoleMatrix AncMatrix;
+		/// all the roles disjoint with a given one
+	TRoleMatrix DJMatrix;
 
 		/// flag whether to create data roles or not
 	bool DataRoles;
@@ -21,11 +21,13 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 //-- Saving/restoring internal state of the FaCT++
 //-------------------------------------------------------
 
+#include <algorithm>
+
 #include "Kernel.h"
 #include "ReasonerNom.h"	// for initReasoner()
 #include "SaveLoadManager.h"
 
-const char* ReasoningKernel :: InternalStateFileHeader = "FaCT++InternalStateDump1.0";
+const char* ReasoningKernel :: InternalStateFileHeader = "FaCT++InternalStateDump1.1";
 
 const int bytesInInt = sizeof(int);
 
@@ -601,6 +603,8 @@ TBox :: Load ( SaveLoadManager& m, KBStatus status )
 		pTax->Load(m);
 	}
 	LoadDagCache(DLHeap,m);
+	if ( Status >= kbRealised )
+		buildDataValueIndex();
 }
 
 void
@@ -641,13 +645,23 @@ ReasoningKernel :: SaveIncremental ( SaveLoadManager& m ) const
 		return;
 	m.o() << "\nQ";
 	m.saveUInt(Name2Sig.size());
+	std::vector<unsigned int> ids;
 	for ( NameSigMap::const_iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
 	{
 		m.savePointer(p->first);
 		m.saveUInt(p->second->size());
 
+		// save signature as a sorted list of gaps between entity indices
+		ids.clear();
 		for ( const TNamedEntity* entity : *p->second )
-			m.savePointer(entity);
+			ids.push_back(m.getEntityIndex(entity));
+		std::sort ( ids.begin(), ids.end() );
+		unsigned int last = 0;
+		for ( unsigned int id : ids )
+		{
+			m.saveUInt(id-last);
+			last = id;
+		}
 	}
 }
 
@@ -657,17 +671,29 @@ ReasoningKernel :: LoadIncremental ( SaveLoadManager& m )
 	if ( !useIncrementalReasoning )
 		return;
 	m.expectChar('Q');
+	for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
+		delete p->second;
 	Name2Sig.clear();
+	Sig2Name.clear();
 	unsigned int size = m.loadUInt();
 	for ( unsigned int j = 0; j < size; j++ )
 	{
 		TNamedEntity* entity = m.loadEntity();
 		unsigned int sigSize = m.loadUInt();
 		TSignature* sig = new TSignature();
+		unsigned int id = 0;
 		for ( unsigned int k = 0; k < sigSize; k++ )
-			sig->add(m.loadEntity());
+		{
+			id += m.loadUInt();
+			sig->add(m.getEntity(id));
+		}
 		Name2Sig[entity] = sig;
+		indexSig ( entity, *sig, /*add=*/true );
 	}
+
+	// the module signatures are ready for the loaded TBox
+	getTBox()->setNameSigMap(&Name2Sig);
+	OntoSig = Ontology.getSignature();
 }
 
 //----------------------------------------------------------
@@ -18,6 +18,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
 #include <fstream>
+#include <sstream>
 
 #include "SaveLoadManager.h"
 #include "tNamedEntry.h"
@@ -25,6 +26,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 bool
 SaveLoadManager :: existsContent ( void ) const
 {
+	if ( inMemory )
+		return op != nullptr || !content.empty();
 	// context is there if a file can be opened
 	return !std::ifstream(filename).fail();
 }
@@ -32,12 +35,17 @@ SaveLoadManager :: existsContent ( void ) const
 void
 SaveLoadManager :: clearContent ( void ) const
 {
-	remove(filename.c_str());
+	if ( !inMemory )
+		remove(filename.c_str());
 }
 
 void
 SaveLoadManager :: prepare ( bool input )
 {
+	// keep the saved content
+	if ( inMemory && op != nullptr )
+		content = static_cast<std::ostringstream*>(op)->str();
+
 	// close all previously open streams
 	delete ip;
 	delete op;
@@ -45,7 +53,14 @@ SaveLoadManager :: prepare ( bool input )
 	op = nullptr;
 
 	// open a new one
-	if ( input )
+	if ( inMemory )
+	{
+		if ( input )
+			ip = new std::istringstream(content);
+		else
+			op = new std::ostringstream;
+	}
+	else if ( input )
 		ip = new std::ifstream(filename);
 	else
 		op = new std::ofstream(filename);
@@ -100,6 +100,10 @@ protected:	// members
 	std::istream* ip = nullptr;
 		/// output stream pointer
 	std::ostream* op = nullptr;
+		/// saved content for the memory-based manager
+	std::string content;
+		/// true iff the content is kept in memory instead of a file
+	bool inMemory = false;
 
 		// uint <-> named entity map for the current taxonomy
 	PointerMap<TNamedEntity> eMap;
@@ -109,8 +113,10 @@ protected:	// members
 	PointerMap<TaxonomyVertex> tvMap;
 
 public:		// methods
-		/// init c'tor: remember the S/L name
-	explicit SaveLoadManager ( const std::string& name ) : dirname(name) { filename = name+".fpp.state"; }
+		/// init c'tor: remember the S/L name; EXT is the extension of the file with the content
+	explicit SaveLoadManager ( const std::string& name, const std::string& ext = ".fpp.state" ) : dirname(name) { filename = name+ext; }
+		/// memory-based S/L: the content lives until the manager is destroyed
+	SaveLoadManager ( void ) : inMemory(true) {}
 		/// empty d'tor
 	~SaveLoadManager()
 	{
@@ -120,6 +126,11 @@ public:		// methods
 
 	// context information
 
+		/// @return the S/L name
+	const std::string& getName ( void ) const { return dirname; }
+		/// @return true iff the content is kept in memory
+	bool isInMemory ( void ) const { return inMemory; }
+
 		/// @return true if there is some S/L content
 	bool existsContent ( void ) const;
 		/// clear all the content corresponding to the manager
@@ -199,6 +210,11 @@ public:		// methods
 		/// save Vertex pointer
 	void savePointer ( const TaxonomyVertex* p ) { saveUInt(tvMap.getI(const_cast<TaxonomyVertex*>(p))); }
 
+		/// get the index of a registered Entity pointer
+	unsigned int getEntityIndex ( const TNamedEntity* p ) { return eMap.getI(p); }
+		/// get the Entity pointer by its index
+	TNamedEntity* getEntity ( unsigned int i ) { return eMap.getP(i); }
+
 		/// load Entry pointer
 	TNamedEntry* loadEntry ( void ) { return neMap.getP(loadUInt()); }
 		/// load Entity pointer
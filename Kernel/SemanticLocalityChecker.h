@@ -20,12 +20,21 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef SEMANTICLOCALITYCHECKER_H
 #define SEMANTICLOCALITYCHECKER_H
 
+#include <vector>
+
 #include "LocalityChecker.h"
 #include "Kernel.h"
+#include "CompiledLocalityChecker.h"
 
 /// semantic locality checker for DL axioms
 class SemanticLocalityChecker: public LocalityChecker
 {
+protected:	// types
+		/// signature class of an axiom: locality flags and the part of the axiom signature that is in the module one
+	typedef std::pair<unsigned int, std::vector<const TNamedEntity*>> SigClass;
+		/// tautology answers for a single axiom wrt its signature classes
+	typedef std::map<SigClass, bool> LocalityCache;
+
 protected:	// members
 		/// Reasoner to detect the tautology
 	ReasoningKernel Kernel;
@@ -33,6 +42,16 @@ protected:	// members
 	TExpressionManager* pEM;
 		/// map between axioms and concept expressions
 	std::map<const TDLAxiom*, const TDLConceptExpression*> ExprMap;
+		/// entities that are registered in the kernel
+	TSignature KernelSig;
+		/// syntactic checker to filter out the axioms that are local anyway
+	CompiledLocalityChecker SynChecker;
+		/// cached results of the tautology checks
+	std::map<const TDLAxiom*, LocalityCache> Cache;
+		/// number of axioms found local by the syntactic checker
+	unsigned long long nSynLocal = 0;
+		/// number of checks answered from the cache
+	unsigned long long nCacheHits = 0;
 
 protected:	// methods
 		/// @return expression necessary to build query for a given type of an axiom; @return NULL if none necessary
@@ -57,10 +76,51 @@ protected:	// methods
 		// everything else doesn't require expression to be build
 		return nullptr;
 	}
+		/// @return (cached) expression necessary to build query for a given AXIOM
+	const TDLConceptExpression* getAxiomExpr ( const TDLAxiom* axiom )
+	{
+		auto p = ExprMap.find(axiom);
+		if ( p == ExprMap.end() )
+			p = ExprMap.emplace ( axiom, getExpr(axiom) ).first;
+		return p->second;
+	}
+		/// @return signature class of an AXIOM wrt the current signature
+	SigClass getSigClass ( const TDLAxiom* axiom ) const
+	{
+		SigClass ret;
+		ret.first = (topCLocal() ? 1 : 0) + (topRLocal() ? 2 : 0);
+		// the tautology check depends only on the names that are NOT replaced by TOP/BOTTOM
+		for ( const TNamedEntity* entity : const_cast<TDLAxiom*>(axiom)->getSignature() )
+			if ( !nc(entity) )
+				ret.second.push_back(entity);
+		return ret;
+	}
+		/// (re-)init the kernel with the signature S; all the previously registered names are kept
+	void initKernel ( const TSignature& s )
+	{
+		// entities keep the entries of the old KB; forget them
+		for ( const TNamedEntity* entity : KernelSig )
+			const_cast<TNamedEntity*>(entity)->setEntry(nullptr);
+		KernelSig.add(s);
+		// NB: this clears the expression manager, so all the cached expressions became invalid
+		Kernel.clearKB();
+		ExprMap.clear();
+		// register all the objects in the known signature
+		for ( const TNamedEntity* entity : KernelSig )
+			Kernel.declare(dynamic_cast<const TDLExpression*>(entity));
+		// prepare the reasoner to check tautologies
+		Kernel.realiseKB();
+		// after TBox appears there, set signature to translate
+		Kernel.setSignature(getSignature());
+		// disallow usage of the expression cache as same expressions will lead to different translations
+		Kernel.setIgnoreExprCache(true);
+	}
 
 public:		// interface
 		/// init c'tor
-	explicit SemanticLocalityChecker ( const TSignature* sig ) : LocalityChecker(sig)
+	explicit SemanticLocalityChecker ( const TSignature* sig )
+		: LocalityChecker(sig)
+		, SynChecker(sig)
 	{
 		pEM = Kernel.getExpressionManager();
 		// for tests we will need TB names to be from the OWL 2 namespace
@@ -71,29 +131,54 @@ public:		// interface
 			"http://www.w3.org/2002/07/owl#bottomDataProperty");
 	}
 
-		/// init kernel with the ontology signature and init expression map
+		/// init kernel with the ontology signature and clear axiom-related caches
 	void preprocessOntology ( const AxiomVec& Axioms ) override
 	{
 		TSignature s;
-		ExprMap.clear();
 		for ( TDLAxiom* axiom : Axioms )
-		{
-			ExprMap[axiom] = getExpr(axiom);
 			s.add(axiom->getSignature());
-		}
 
-		Kernel.clearKB();
-		// register all the objects in the ontology signature
-		for (const TNamedEntity* entity : s)
-			Kernel.declare(dynamic_cast<const TDLExpression*>(entity));
-		// prepare the reasoner to check tautologies
-		Kernel.realiseKB();
-		// after TBox appears there, set signature to translate
-		Kernel.setSignature(getSignature());
-		// disallow usage of the expression cache as same expressions will lead to different translations
-		Kernel.setIgnoreExprCache(true);
+		// the kernel has no axioms, so it only has to be reloaded if there are new names
+		if ( !(s <= KernelSig) )
+			initKernel(s);
+
+		// axioms might be different from the last time, so clear all the axiom-related info
+		Cache.clear();
+		ExprMap.clear();
+		SynChecker.preprocessOntology(Axioms);
 	}
 
+	using LocalityChecker::local;
+
+		/// @return true iff an AXIOM is local wrt signature
+	bool local ( const TDLAxiom* axiom ) override
+	{
+		// syntactic locality implies the semantic one
+		if ( SynChecker.local(axiom) )
+		{
+			++nSynLocal;
+			return true;
+		}
+		// the answer is defined by the part of the axiom's signature that is in SIG
+		LocalityCache& AxCache = Cache[axiom];
+		SigClass sigClass = getSigClass(axiom);
+		LocalityCache::const_iterator p = AxCache.find(sigClass);
+		if ( p != AxCache.end() )
+		{
+			++nCacheHits;
+			return p->second;
+		}
+		// not known: ask the reasoner
+		bool ret = LocalityChecker::local(axiom);
+		AxCache[sigClass] = ret;
+		return ret;
+	}
+
+		/// @return number of axioms found local by the syntactic checker
+	unsigned long long getNSynLocal ( void ) const { return nSynLocal; }
+		/// @return number of checks answered from the cache
+	unsigned long long getNCacheHits ( void ) const { return nCacheHits; }
+
 public:		// visitor interface
 	void visit ( const TDLAxiomDeclaration& ) override { isLocal = true; }
 
@@ -199,11 +284,11 @@ public:		// visitor interface
 	}
 	void visit ( const TDLAxiomDRoleSubsumption& axiom ) override { isLocal = Kernel.isSubRoles ( axiom.getSubRole(), axiom.getRole() ); }
 		// Domain(R) = C is tautology iff ER.Top [= C
-	void visit ( const TDLAxiomORoleDomain& axiom ) override { isLocal = Kernel.isSubsumedBy ( ExprMap[&axiom], axiom.getDomain() ); }
-	void visit ( const TDLAxiomDRoleDomain& axiom ) override { isLocal = Kernel.isSubsumedBy ( ExprMap[&axiom], axiom.getDomain() ); }
+	void visit ( const TDLAxiomORoleDomain& axiom ) override { isLocal = Kernel.isSubsumedBy ( getAxiomExpr(&axiom), axiom.getDomain() ); }
+	void visit ( const TDLAxiomDRoleDomain& axiom ) override { isLocal = Kernel.isSubsumedBy ( getAxiomExpr(&axiom), axiom.getDomain() ); }
 		// Range(R) = C is tautology iff ER.~C is unsatisfiable
-	void visit ( const TDLAxiomORoleRange& axiom ) override { isLocal = !Kernel.isSatisfiable(ExprMap[&axiom]); }
-	void visit ( const TDLAxiomDRoleRange& axiom ) override { isLocal = !Kernel.isSatisfiable(ExprMap[&axiom]); }
+	void visit ( const TDLAxiomORoleRange& axiom ) override { isLocal = !Kernel.isSatisfiable(getAxiomExpr(&axiom)); }
+	void visit ( const TDLAxiomDRoleRange& axiom ) override { isLocal = !Kernel.isSatisfiable(getAxiomExpr(&axiom)); }
 	void visit ( const TDLAxiomRoleTransitive& axiom ) override { isLocal = Kernel.isTransitive(axiom.getRole()); }
 	void visit ( const TDLAxiomRoleReflexive& axiom ) override { isLocal = Kernel.isReflexive(axiom.getRole()); }
 	void visit ( const TDLAxiomRoleIrreflexive& axiom ) override { isLocal = Kernel.isIrreflexive(axiom.getRole()); }
@@ -217,13 +302,13 @@ public:		// visitor interface
 		// for top locality, this might be local
 	void visit ( const TDLAxiomInstanceOf& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), axiom.getC() ); }
 		// R(i,j) holds if {i} [= \ER.{j}
-	void visit ( const TDLAxiomRelatedTo& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	void visit ( const TDLAxiomRelatedTo& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(&axiom) ); }
 		///!R(i,j) holds if {i} [= \AR.!{j}=!\ER.{j}
-	void visit ( const TDLAxiomRelatedToNot& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	void visit ( const TDLAxiomRelatedToNot& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(&axiom) ); }
 		// R(i,v) holds if {i} [= \ER.{v}
-	void visit ( const TDLAxiomValueOf& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	void visit ( const TDLAxiomValueOf& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(&axiom) ); }
 		// !R(i,v) holds if {i} [= !\ER.{v}
-	void visit ( const TDLAxiomValueOfNot& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	void visit ( const TDLAxiomValueOfNot& axiom ) override { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(&axiom) ); }
 }; // SemanticLocalityChecker
 
 #endif
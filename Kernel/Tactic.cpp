@@ -461,15 +461,12 @@ bool DlSatTester :: applyTransitions ( const DlCompletionTreeArc* edge,
 	if ( RST.isSingleton() )
 		return addToDoEntry ( node, C+(BipolarPointer)RST.getTransitionEnd(), dep, reason );
 
-	const TRole* R = edge->getRole();
+	unsigned int index = edge->getRole()->getIndex();
 
-	// try to apply all transitions to edge
-	for ( const auto& trans: RST )
-	{
-		incStat(nAutoTransLookups);
-		if ( trans.applicable(R) )
-			switchResult ( addToDoEntry ( node, C+BipolarPointer(trans.final()), dep, reason ) );
-	}
+	// apply all transitions applicable to the edge
+	incStat(nAutoTransLookups);
+	for ( RAStateTransitions::succ_iterator p = RST.succ_begin(index), p_end = RST.succ_end(index); p != p_end; ++p )
+		switchResult ( addToDoEntry ( node, C+BipolarPointer(*p), dep, reason ) );
 
 	return false;
 }
@@ -30,6 +30,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 Taxonomy :: ~Taxonomy()
 {
 	delete Current;
+	delete Index;
 	for ( TaxVertexVec::iterator p = Graph.begin(), p_end = Graph.end(); p < p_end; ++p )
 		delete *p;
 }
@@ -108,6 +109,11 @@ Taxonomy :: finalise ( void )
 			getBottomVertex()->addNeighbour ( !upDirection, *p );
 		}
 	willInsertIntoTaxonomy = false;	// after finalisation one shouldn't add new entries to taxonomy
+	if ( useIndex )
+	{
+		delete Index;
+		Index = new TaxonomyIndex(getTopVertex());
+	}
 }
 
 /// unlink the bottom from the taxonomy
@@ -120,4 +126,22 @@ Taxonomy :: deFinalise ( void )
 		(*p)->removeLink ( !upDirection, bot );
 	bot->clearLinks(upDirection);
 	willInsertIntoTaxonomy = true;	// it's possible again to add entries
+	// the index is no longer valid
+	delete Index;
+	Index = nullptr;
+}
+
+/// remove the vertex of an entry E from the de-finalised taxonomy
+void
+Taxonomy :: removeEntry ( const ClassifiableEntry* e )
+{
+	TaxonomyVertex* v = e->getTaxVertex();
+	if ( v == nullptr || v == getTopVertex() || v == getBottomVertex() )
+		return;
+
+	fpp_assert ( !queryMode() );
+	const_cast<ClassifiableEntry*>(v->getPrimer())->setTaxVertex(nullptr);
+	for ( const auto& syn: v->synonyms() )
+		const_cast<ClassifiableEntry*>(syn)->setTaxVertex(nullptr);
+	v->remove();
 }
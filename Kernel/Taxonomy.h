@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 // taxonomy graph for DL
 
 #include "taxVertex.h"
+#include "TaxonomyIndex.h"
 #include "WalkerInterface.h"
 
 class SaveLoadManager;
@@ -44,8 +45,13 @@ protected:	// members
 		/// aux vertex to be included to taxonomy
 	TaxonomyVertex* Current;
 
+		/// frozen index of the finalised taxonomy; NULL if not built
+	TaxonomyIndex* Index = nullptr;
+
 		/// behaviour flag: if true, insert temporary vertex into taxonomy
 	bool willInsertIntoTaxonomy = true;
+		/// behaviour flag: if true, build an index of the taxonomy on finalisation
+	bool useIndex = false;
 
 public:		// classification interface
 
@@ -76,6 +82,10 @@ public:		// classification interface
 	void finalise ( void );
 		/// unlink the bottom from the taxonomy
 	void deFinalise ( void );
+		/// remove the vertex of an entry E from the de-finalised taxonomy; all its entries become unclassified
+	void removeEntry ( const ClassifiableEntry* e );
+		/// set the flag to build an index on finalisation
+	void setUseIndex ( bool use ) { useIndex = use; }
 
 protected:	// methods
 		/// apply ACTOR to subgraph starting from NODE as defined by flags
@@ -131,6 +141,10 @@ public:		// interface
 	TaxonomyVertex* getCurrent ( void ) { return Current; }
 		/// get RO access to current
 	const TaxonomyVertex* getCurrent ( void ) const { return Current; }
+		/// RO iterator over all the vertices (including unused ones); BOTTOM and TOP go first
+	TaxVertexVec::const_iterator begin ( void ) const { return Graph.begin(); }
+		/// end of the vertices
+	TaxVertexVec::const_iterator end ( void ) const { return Graph.end(); }
 		/// set current to a given node
 	void setCurrent ( TaxonomyVertex* cur ) { Current = cur; }
 
@@ -145,12 +159,25 @@ public:		// interface
 			if ( actor.apply(*node) && onlyDirect )
 				return;
 
+		// frozen taxonomy: all relatives are known without traversal
+		if ( !onlyDirect && Index != nullptr )
+		{
+			Index->getRelativesInfo<upDirection>(node,actor);
+			return;
+		}
+
 		for ( TaxonomyVertex::iterator p = node->begin(upDirection), p_end = node->end(upDirection); p != p_end; ++p )
 			getRelativesInfoRec<onlyDirect, upDirection> ( *p, actor );
 
 		clearVisited();
 	}
 
+		/// @return true iff SUB is a sub-vertex of SUP; both vertices should be indexed
+	bool isSubVertex ( const TaxonomyVertex* sub, const TaxonomyVertex* sup ) const
+		{ return sub == sup || Index->isBelow ( sub, sup ); }
+		/// @return true iff the taxonomy index is built and covers vertex V
+	bool isIndexed ( const TaxonomyVertex* v ) const { return Index != nullptr && Index->isIndexed(v); }
+
 	// taxonomy info access
 
 		/// print taxonomy info to a stream
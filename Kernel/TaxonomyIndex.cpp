@@ -0,0 +1,165 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "TaxonomyIndex.h"
+
+TaxonomyIndex :: TaxonomyIndex ( TaxonomyVertex* top )
+{
+	buildOrder(top);
+
+	unsigned int n = (unsigned int)Order.size();
+	Down.resize(n);
+	Up.resize(n);
+
+	// descendants are later in the order, so fill them from the end
+	for ( unsigned int pos = n; pos > 0; --pos )
+		buildWindow ( pos-1, /*upDirection=*/false );
+	// ancestors are earlier in the order, so fill them from the beginning
+	for ( unsigned int pos = 0; pos < n; ++pos )
+		buildWindow ( pos, /*upDirection=*/true );
+}
+
+void
+TaxonomyIndex :: buildOrder ( TaxonomyVertex* top )
+{
+	// iterative DFS to deal with deep taxonomies
+	typedef std::pair<TaxonomyVertex*, TaxonomyVertex::iterator> StackElem;
+	std::vector<StackElem> stack;
+	std::unordered_set<const TaxonomyVertex*> visited;
+	TaxVertexVec postOrder;
+
+	visited.insert(top);
+	stack.push_back(StackElem(top,top->begin(/*upDirection=*/false)));
+
+	while ( !stack.empty() )
+	{
+		TaxonomyVertex* v = stack.back().first;
+		TaxonomyVertex::iterator& p = stack.back().second;
+		if ( p == v->end(/*upDirection=*/false) )
+		{
+			postOrder.push_back(v);
+			stack.pop_back();
+			continue;
+		}
+		TaxonomyVertex* child = *p++;
+		if ( child->isInUse() && visited.insert(child).second )
+			stack.push_back(StackElem(child,child->begin(/*upDirection=*/false)));
+	}
+
+	Order.assign ( postOrder.rbegin(), postOrder.rend() );
+	for ( unsigned int pos = 0, n = (unsigned int)Order.size(); pos < n; ++pos )
+		Order[pos]->setIndexPos(pos);
+}
+
+void
+TaxonomyIndex :: buildWindow ( unsigned int pos, bool upDirection )
+{
+	PosWindow& w = upDirection ? Up[pos] : Down[pos];
+	const TaxonomyVertex* v = Order[pos];
+
+	// determine the window borders
+	bool first = true;
+	for ( TaxonomyVertex::const_iterator p = v->begin(upDirection), p_end = v->end(upDirection); p != p_end; ++p )
+	{
+		if ( !isIndexed(*p) )
+			continue;
+		unsigned int nPos = (*p)->getIndexPos();
+		const PosWindow& nw = getWindow ( nPos, upDirection );
+		unsigned int b = nPos, e = nPos+1;
+		if ( !nw.empty() )
+		{
+			b = std::min ( b, nw.Begin );
+			e = std::max ( e, nw.End );
+		}
+		if ( first )
+		{
+			w.Begin = b;
+			w.End = e;
+			first = false;
+		}
+		else
+		{
+			w.Begin = std::min ( w.Begin, b );
+			w.End = std::max ( w.End, e );
+		}
+	}
+
+	if ( w.empty() )
+		return;
+
+	// fill the bitmap with the neighbours and their relatives
+	w.Bits.assign ( (w.End - w.Begin + WordBits - 1)/WordBits, 0 );
+	for ( TaxonomyVertex::const_iterator p = v->begin(upDirection), p_end = v->end(upDirection); p != p_end; ++p )
+	{
+		if ( !isIndexed(*p) )
+			continue;
+		unsigned int nPos = (*p)->getIndexPos() - w.Begin;
+		w.Bits[nPos/WordBits] |= Word(1) << (nPos%WordBits);
+		const PosWindow& nw = getWindow ( (*p)->getIndexPos(), upDirection );
+		if ( nw.empty() )
+			continue;
+		if ( nw.isInterval() )
+			for ( unsigned int i = nw.Begin - w.Begin, i_end = nw.End - w.Begin; i < i_end; ++i )
+				w.Bits[i/WordBits] |= Word(1) << (i%WordBits);
+		else	// shift the relative's bitmap into the current window
+		{
+			unsigned int shift = nw.Begin - w.Begin;
+			for ( unsigned int i = 0, n = (unsigned int)nw.Bits.size(); i < n; ++i )
+			{
+				Word x = nw.Bits[i];
+				if ( x == 0 )
+					continue;
+				unsigned int bit = shift + i*WordBits;
+				w.Bits[bit/WordBits] |= x << (bit%WordBits);
+				if ( bit%WordBits != 0 && bit/WordBits + 1 < w.Bits.size() )
+					w.Bits[bit/WordBits+1] |= x >> (WordBits - bit%WordBits);
+			}
+		}
+	}
+
+	compress(w);
+}
+
+void
+TaxonomyIndex :: compress ( PosWindow& w )
+{
+	unsigned int size = w.End - w.Begin;
+	for ( unsigned int i = 0; i < size/WordBits; ++i )
+		if ( w.Bits[i] != ~Word(0) )
+			return;
+	unsigned int rest = size%WordBits;
+	if ( rest != 0 && w.Bits.back() != (Word(1) << rest) - 1 )
+		return;
+	// all bits are set: keep the interval only
+	std::vector<Word>().swap(w.Bits);
+}
+
+size_t
+TaxonomyIndex :: getBitmapSize ( void ) const
+{
+	size_t ret = 0;
+	for ( const auto& w: Down )
+		ret += w.Bits.size();
+	for ( const auto& w: Up )
+		ret += w.Bits.size();
+	return ret*sizeof(Word);
+}
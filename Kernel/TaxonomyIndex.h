@@ -0,0 +1,182 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2003-2015 Dmitry Tsarkov and The University of Manchester
+Copyright (C) 2015-2017 Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TAXONOMYINDEX_H
+#define TAXONOMYINDEX_H
+
+#include <vector>
+
+#include "taxVertex.h"
+
+class Taxonomy;
+
+/// frozen index of a finalised taxonomy: topological numbering of the vertices
+/// together with the windowed ancestor/descendant bitmaps over that numbering
+class TaxonomyIndex
+{
+protected:	// types
+		/// vector of taxonomy vertices
+	typedef std::vector<TaxonomyVertex*> TaxVertexVec;
+		/// storage unit for the bitmaps
+	typedef unsigned long long Word;
+
+		/// set of vertex positions within [Begin,End); either an interval or a bitmap over it
+	class PosWindow
+	{
+	public:		// members
+			/// the first position in the window
+		unsigned int Begin = 0;
+			/// position after the last one in the window
+		unsigned int End = 0;
+			/// bitmap over [Begin,End); empty if all positions within the window are in the set
+		std::vector<Word> Bits;
+
+	public:		// interface
+			/// @return true if the set is empty
+		bool empty ( void ) const { return Begin == End; }
+			/// @return true if the set is exactly the interval [Begin,End)
+		bool isInterval ( void ) const { return Bits.empty(); }
+			/// @return true iff POS is in the set
+		bool contains ( unsigned int pos ) const
+		{
+			if ( pos < Begin || pos >= End )
+				return false;
+			if ( isInterval() )
+				return true;
+			pos -= Begin;
+			return (Bits[pos/WordBits] >> (pos%WordBits)) & 1;
+		}
+			/// apply F to every position in the set in the increasing order
+		template<class Functor>
+		void forEach ( Functor& f ) const
+		{
+			if ( isInterval() )
+			{
+				for ( unsigned int pos = Begin; pos < End; ++pos )
+					f(pos);
+				return;
+			}
+			for ( unsigned int i = 0, n = (unsigned int)Bits.size(); i < n; ++i )
+				for ( Word w = Bits[i], pos = Begin + i*WordBits; w != 0; w >>= 1, ++pos )
+					if ( w & 1 )
+						f((unsigned int)pos);
+		}
+	}; // PosWindow
+
+		/// functor that applies an actor to the vertex at a given position
+	template<class Actor>
+	class ApplyActor
+	{
+	protected:	// members
+			/// vertices in topological order
+		const TaxVertexVec& Order;
+			/// actor to apply
+		Actor& actor;
+
+	public:		// interface
+			/// init c'tor
+		ApplyActor ( const TaxVertexVec& order, Actor& a ) : Order(order), actor(a) {}
+			/// apply actor to the vertex at position POS
+		void operator() ( unsigned int pos ) { actor.apply(*Order[pos]); }
+	}; // ApplyActor
+
+		/// functor that marks given position in a vector
+	class MarkPos
+	{
+	protected:	// members
+			/// marks to set
+		std::vector<bool>& Marks;
+
+	public:		// interface
+			/// init c'tor
+		explicit MarkPos ( std::vector<bool>& marks ) : Marks(marks) {}
+			/// mark position POS
+		void operator() ( unsigned int pos ) { Marks[pos] = true; }
+	}; // MarkPos
+
+protected:	// members
+		/// number of bits in the storage unit
+	static const unsigned int WordBits = sizeof(Word)*8;
+		/// all indexed vertices in topological order (TOP first, BOTTOM last)
+	TaxVertexVec Order;
+		/// descendants of every vertex, indexed by a position
+	std::vector<PosWindow> Down;
+		/// ancestors of every vertex, indexed by a position
+	std::vector<PosWindow> Up;
+
+protected:	// methods
+		/// fill Order by a reverse post-order DFS from TOP; that keeps DFS sub-trees contiguous
+	void buildOrder ( TaxonomyVertex* top );
+		/// build window W of all the UPDIRECTION relatives of the vertex at position POS
+	void buildWindow ( unsigned int pos, bool upDirection );
+		/// convert the window to the interval form if all its bits are set
+	static void compress ( PosWindow& w );
+		/// get relatives of a vertex in a given direction
+	const PosWindow& getWindow ( unsigned int pos, bool upDirection ) const { return upDirection ? Up[pos] : Down[pos]; }
+
+public:		// interface
+		/// build an index for the finalised taxonomy with the given TOP vertex
+	explicit TaxonomyIndex ( TaxonomyVertex* top );
+		/// no copy c'tor
+	TaxonomyIndex ( const TaxonomyIndex& ) = delete;
+		/// no assignment
+	TaxonomyIndex& operator = ( const TaxonomyIndex& ) = delete;
+
+		/// @return true iff vertex V is in the index
+	bool isIndexed ( const TaxonomyVertex* v ) const
+	{
+		unsigned int pos = v->getIndexPos();
+		return pos < Order.size() && Order[pos] == v;
+	}
+		/// @return true iff SUB is a (strict) descendant of SUP; both are indexed
+	bool isBelow ( const TaxonomyVertex* sub, const TaxonomyVertex* sup ) const
+		{ return Down[sup->getIndexPos()].contains(sub->getIndexPos()); }
+
+		/// apply ACTOR to all the UPDIRECTION relatives of NODE (excluding NODE itself) in the topological order
+	template<bool upDirection, class Actor>
+	void getRelativesInfo ( const TaxonomyVertex* node, Actor& actor ) const
+	{
+		ApplyActor<Actor> f ( Order, actor );
+		if ( likely(isIndexed(node)) )
+		{
+			getWindow ( node->getIndexPos(), upDirection ).forEach(f);
+			return;
+		}
+
+		// node is not in the index (eg, query or fresh one): join the relatives of its neighbours
+		std::vector<bool> Marks(Order.size(), false);
+		MarkPos mark(Marks);
+		for ( TaxonomyVertex::const_iterator p = node->begin(upDirection), p_end = node->end(upDirection); p != p_end; ++p )
+			if ( isIndexed(*p) )
+			{
+				Marks[(*p)->getIndexPos()] = true;
+				getWindow ( (*p)->getIndexPos(), upDirection ).forEach(mark);
+			}
+		for ( unsigned int pos = 0, n = (unsigned int)Order.size(); pos < n; ++pos )
+			if ( Marks[pos] )
+				f(pos);
+	}
+
+		/// get the number of indexed vertices
+	size_t size ( void ) const { return Order.size(); }
+		/// get the number of bytes used for bitmaps
+	size_t getBitmapSize ( void ) const;
+}; // TaxonomyIndex
+
+#endif
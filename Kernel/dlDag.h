@@ -269,6 +269,12 @@ public:		// interface
 		/// set cache for given BiPointer; @return given cache
 	void setCache ( BipolarPointer p, const modelCacheInterface* cache )
 		{ operator[](p).setCache ( isPositive(p), cache ); }
+		/// remove the caches of all the entries (e.g., after the concept definitions are changed)
+	void clearCaches ( void )
+	{
+		for ( auto& v: Heap )
+			v->clearCache();
+	}
 
 	// sort interface
 
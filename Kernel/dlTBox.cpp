@@ -20,12 +20,14 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "dlTBox.h"
 
 #include <fstream>
+#include <algorithm>
 
 #include "cppi.h"
 
 #include "globaldef.h"
 #include "ReasonerNom.h"
 #include "DLConceptTaxonomy.h"
+#include "InstanceIndex.h"
 #include "procTimer.h"
 #include "dumpLisp.h"
 #include "logging.h"
@@ -71,6 +73,9 @@ TBox :: ~TBox()
 	// remove aux structures
 	delete stdReasoner;
 	delete nomReasoner;
+	clearABoxParts();
+	delete pInstIndex;
+	delete pDataIndex;
 	delete pTax;
 	delete pTaxCreator;
 }
@@ -186,6 +191,34 @@ void TBox :: prepareFeatures ( const TConcept* pConcept, const TConcept* qConcep
 		updateAuxFeatures(NCFeatures);
 	curFeature = &auxFeatures;
 
+	// a test on an individual only needs its own ABox part unless the query refers to other nominals
+	curNomReasoner = nullptr;
+	if ( !Ind2PartReasoner.empty() && pConcept != nullptr && ( qConcept == nullptr || !qConcept->negFeatures.hasSingletons() ) )
+	{
+		auto p = Ind2PartReasoner.find(resolveSynonym(pConcept));
+		if ( p != Ind2PartReasoner.end() )
+			curNomReasoner = p->second;
+	}
+
+	prepareReasoner();
+}
+
+/// prepare features of the whole KB for a role test
+void TBox :: prepareKBFeatures ( void )
+{
+	// FIXME!! overkill, but fine for now as it is sound
+	curFeature = &KBFeatures;
+	curNomReasoner = nullptr;
+	prepareReasoner();
+}
+
+/// make sure the reasoner for the current features is ready
+void TBox :: prepareReasoner ( void )
+{
+	// the test needs all the nominals together
+	if ( curFeature->hasSingletons() && curNomReasoner == nullptr && !ABoxPartReasoners.empty() )
+		checkWholeNominalCloud();
+
 	// set blocking method for the current reasoning session
 	getReasoner()->setBlockingMethod ( isIRinQuery(), isNRinQuery() );
 }
@@ -238,7 +271,11 @@ TBox :: performConsistencyCheck ( void )
 		if ( DLHeap.getCache(bpTOP) == nullptr )
 			initConstCache(bpTOP);
 
-		ret = static_cast<NominalReasoner*>(nomReasoner)->consistentNominalCloud();
+		// without nominals in concepts and universal role the ABox parts don't interact
+		if ( useABoxPartitioning && nNominalReferences == 0 && !KBFeatures.hasTopRole() && initABoxParts() )
+			ret = consistentABoxParts();
+		else
+			ret = static_cast<NominalReasoner*>(nomReasoner)->consistentNominalCloud();
 	}
 	else
 		ret = isSatisfiable(pTop);
@@ -259,6 +296,431 @@ TBox :: performConsistencyCheck ( void )
 	return ret;
 }
 
+void
+TBox :: buildABoxComponents ( std::vector<SingletonVector>& Components ) const
+{
+	// union-find over the individuals' indices
+	std::map<const TIndividual*, size_t> Index;
+	SingletonVector Inds;
+	for ( i_const_iterator pi = i_begin(); pi != i_end(); ++pi )
+		if ( !(*pi)->isSynonym() )
+		{
+			Index[*pi] = Inds.size();
+			Inds.push_back(*pi);
+		}
+
+	std::vector<size_t> Parent(Inds.size());
+	for ( size_t i = 0; i < Parent.size(); ++i )
+		Parent[i] = i;
+	auto root = [&Parent] ( size_t i )
+	{
+		while ( Parent[i] != i )
+			i = Parent[i] = Parent[Parent[i]];
+		return i;
+	};
+	auto join = [&] ( const TIndividual* a, const TIndividual* b )
+		{ Parent[root(Index[resolveSynonym(a)])] = root(Index[resolveSynonym(b)]); };
+
+	for ( RelatedCollection::const_iterator q = RelatedI.begin(), q_end = RelatedI.end(); q < q_end; ++q, ++q )
+		join ( (*q)->a, (*q)->b );
+	for ( const auto& di: Different )
+		for ( const auto& ind: di )
+			join ( di.front(), ind );
+
+	// gather components wrt their roots
+	std::map<size_t, size_t> Root2Comp;
+	Components.clear();
+	for ( size_t i = 0; i < Inds.size(); ++i )
+	{
+		auto ins = Root2Comp.insert(std::make_pair(root(i),Components.size()));
+		if ( ins.second )
+			Components.push_back(SingletonVector());
+		Components[ins.first->second].push_back(Inds[i]);
+	}
+}
+
+/// max number of ABox parts. Every part has a reasoner of its own, with its own completion graph and
+/// caches; more parts make every part smaller, but cost more memory and more set-up work
+static const size_t MaxABoxParts = 16;
+
+bool
+TBox :: initABoxParts ( void )
+{
+	std::vector<SingletonVector> Components;
+	buildABoxComponents(Components);
+	nABoxComponents = Components.size();
+	maxABoxComponent = 0;
+	for ( const auto& comp: Components )
+		maxABoxComponent = std::max ( maxABoxComponent, comp.size() );
+
+	// single component is the whole ABox: nothing to gain
+	if ( nABoxComponents < 2 )
+		return false;
+
+	// every part has its own completion graph, so the small components are packed together.
+	// Put the largest remaining component into the smallest part
+	std::vector<SingletonVector> Parts ( std::min ( MaxABoxParts, nABoxComponents ) );
+	std::sort ( Components.begin(), Components.end(),
+		[] ( const SingletonVector& c1, const SingletonVector& c2 ) { return c1.size() > c2.size(); } );
+	auto smaller = [] ( const SingletonVector& p1, const SingletonVector& p2 ) { return p1.size() < p2.size(); };
+	for ( const auto& comp: Components )
+	{
+		SingletonVector& part = *std::min_element ( Parts.begin(), Parts.end(), smaller );
+		part.insert ( part.end(), comp.begin(), comp.end() );
+	}
+
+	for ( const auto& part: Parts )
+	{
+		NominalReasoner* Reasoner = new NominalReasoner ( *this, part );
+		ABoxPartReasoners.push_back(Reasoner);
+		for ( auto& ind: part )
+			Ind2PartReasoner[ind] = Reasoner;
+	}
+	return true;
+}
+
+bool
+TBox :: consistentABoxParts ( void )
+{
+	for ( auto& reasoner: ABoxPartReasoners )
+	{
+		NominalReasoner* Reasoner = static_cast<NominalReasoner*>(reasoner);
+		Reasoner->setBlockingMethod ( isIRinQuery(), isNRinQuery() );
+		if ( !Reasoner->consistentNominalCloud() )
+		{
+			if ( LLM.isWritable(llSatResult) )
+				LL << "\nABox part with '" << Reasoner->getNominals().front()->getName() << "' is inconsistent";
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+TBox :: checkWholeNominalCloud ( void )
+{
+	// all the parts are consistent and don't interact, so the whole cloud is consistent as well
+	nomReasoner->setBlockingMethod ( isIRinQuery(), isNRinQuery() );
+	if ( !static_cast<NominalReasoner*>(nomReasoner)->consistentNominalCloud() )
+		throw EFaCTPlusPlus("FaCT++ Kernel: inconsistent nominal cloud with consistent ABox parts");
+	// the individuals are linked to the nodes of the whole cloud now
+	clearABoxParts();
+}
+
+void
+TBox :: clearABoxParts ( void )
+{
+	for ( auto& reasoner: ABoxPartReasoners )
+		delete reasoner;
+	ABoxPartReasoners.clear();
+	Ind2PartReasoner.clear();
+}
+
+void
+TBox :: startABoxUpdate ( void )
+{
+	fpp_assert ( canUpdateABox() );
+
+	// new DAG entries should go after the ones of KB, so remove the query
+	clearQueryConcept();
+	UpdatedIndividuals.clear();
+	// new individuals are allowed
+	Individuals.setLocked(false);
+}
+
+/// @return true iff a tree T contains a nominal
+static bool
+hasNominal ( const DLTree* t )
+{
+	if ( t == nullptr )
+		return false;
+	if ( t->Element().getToken() == INAME )
+		return true;
+	return hasNominal(t->Left()) || hasNominal(t->Right());
+}
+
+bool
+TBox :: addInstanceAssertion ( TIndividual* I, DLTree* C )
+{
+	// nominals might change the concept hierarchy
+	if ( I->isSynonym() || hasNominal(C) )
+	{
+		deleteTree(C);
+		return false;
+	}
+
+	UpdatedIndividuals.insert(I);
+	addToldDataValues ( I, C );
+
+	// fresh individual: the description would be translated later
+	if ( !isValid(I->pName) )
+	{
+		I->addDesc(C);
+		return true;
+	}
+
+	// add C to the body of the known individual
+	I->pBody = and2dag ( I->pBody, tree2dag(C) );
+	DLHeap[I->pName].setChild(I->pBody);
+	deleteTree(C);
+	return true;
+}
+
+bool
+TBox :: addRelatedAssertion ( TIndividual* I, TRole* R, TIndividual* J )
+{
+	if ( I->isSynonym() || J->isSynonym() )
+		return false;
+
+	RegisterIndividualRelation ( I, R, J );
+	// do the same as preprocessRelated()
+	RelatedI[RelatedI.size()-2]->simplify();
+	RelatedI.back()->simplify();
+
+	UpdatedIndividuals.insert(I);
+	UpdatedIndividuals.insert(J);
+	return true;
+}
+
+void
+TBox :: finishABoxUpdate ( void )
+{
+	TsProcTimer pt;
+	pt.Start();
+
+	Individuals.setLocked(true);
+
+	for ( i_iterator pi = i_begin(); pi != i_end(); ++pi )
+		if ( UpdatedIndividuals.count(*pi) > 0 )
+			preprocessUpdatedIndividual(*pi);
+
+	// assertions with nominals are rejected by addInstanceAssertion()
+	fpp_assert ( nNominalReferences == 0 );
+
+	// keep new DAG entries when the query is removed
+	DLHeap.setFinalSize();
+	// new assertions might join some sorts
+	determineSorts();
+
+	// update features of the nominal cloud
+	for ( auto& ind: UpdatedIndividuals )
+	{
+		setConceptRelevant(ind);
+		NCFeatures |= ind->posFeatures;
+	}
+	if ( NCFeatures.hasSomeAll() && !RelatedI.empty() )
+		NCFeatures.setInverseRoles();
+	curFeature = nullptr;
+
+	// fresh primitive individuals need the same caches as the old ones
+	if ( !GCIs.isGCI() && !GCIs.isReflexive() )
+		for ( auto& ind: UpdatedIndividuals )
+			if ( ind->isPrimitive() && DLHeap.getCache(inverse(ind->pName)) == nullptr )
+				initSingletonCache ( ind, /*pos=*/false );
+
+	// types of every individual connected to the updated ones might change, so they should be realised again
+	std::vector<SingletonVector> Components;
+	buildABoxComponents(Components);
+	if ( pTax != nullptr )
+		pTax->deFinalise();
+	delete pInstIndex;
+	pInstIndex = nullptr;
+	delete pDataIndex;
+	pDataIndex = nullptr;
+	auto isUpdated = [this] ( TIndividual* ind ) { return UpdatedIndividuals.count(ind) > 0; };
+	for ( const auto& comp: Components )
+		if ( std::any_of ( comp.begin(), comp.end(), isUpdated ) )
+			for ( auto& ind: comp )
+			{
+				ind->clearRelatedMap();
+				if ( pTax != nullptr )
+					pTax->removeEntry(ind);
+			}
+	UpdatedIndividuals.clear();
+
+	// re-check the whole nominal cloud with the new assertions
+	clearABoxParts();
+	DLHeap.setSatOrder();
+	prepareFeatures ( *i_begin(), nullptr );
+	setConsistency(static_cast<NominalReasoner*>(nomReasoner)->recheckNominalCloud());
+
+	pt.Stop();
+	consistTime = pt;
+	if ( LLM.isWritable(llSatResult) )
+		LL << "\nABox update is done in " << pt << " seconds";
+}
+
+void
+TBox :: startTBoxUpdate ( void )
+{
+	fpp_assert ( canUpdateTBox() );
+
+	// new DAG entries should go after the ones of KB, so remove the query
+	clearQueryConcept();
+	UpdatedConcepts.clear();
+	// fresh concepts are allowed; they are registered after the known ones
+	nOldConcepts = static_cast<size_t>(c_end() - c_begin());
+	Concepts.setLocked(false);
+}
+
+void
+TBox :: addToldSubsumption ( TConcept* C, DLTree* D )
+{
+	// keep the replacement flag if it is already set
+	UpdatedConcepts.insert(std::make_pair(C,false));
+	C->addDesc(D);
+}
+
+/// @return true iff P is a (maybe indirect) told subsumer of C; use VISITED to record explored entries
+static bool
+isToldSubsumer ( const ClassifiableEntry* C, const ClassifiableEntry* P, std::set<const ClassifiableEntry*>& visited )
+{
+	for ( const auto& q: C->told() )
+		if ( q == P || ( visited.insert(q).second && isToldSubsumer ( q, P, visited ) ) )
+			return true;
+	return false;
+}
+
+/// @return true iff C or one of its (maybe indirect) told subsumers is changed; KNOWN contains the results found so far
+static bool
+hasChangedToldSubsumer ( const TConcept* C, std::map<const TConcept*, bool>& Known )
+{
+	auto p = Known.find(C);
+	if ( p != Known.end() )
+		return p->second;
+	bool ret = false;
+	for ( const auto& q: C->told() )
+		if ( hasChangedToldSubsumer ( static_cast<const TConcept*>(q), Known ) )
+		{
+			ret = true;
+			break;
+		}
+	return Known[C] = ret;
+}
+
+void
+TBox :: finishTBoxUpdate ( void )
+{
+	TsProcTimer pt;
+	pt.Start();
+
+	Concepts.setLocked(true);
+
+	// fresh concepts are preprocessed as the loaded ones
+	ConceptVector Changed ( c_begin() + static_cast<long>(nOldConcepts), c_end() );
+	for ( auto& C: Changed )
+	{
+		// the last index is reserved for the query concept; move it further
+		C->setIndex(nC-1);
+		ConceptMap.push_back(C);
+		++nC;
+		C->initToldSubsumers();
+		C->setToldTop(pTop);
+	}
+	size_t nFresh = Changed.size();
+
+	// extended concepts keep the old told subsumers; replaced ones get them from the new description only
+	std::vector<std::pair<TConcept*, bool>> Updated;
+	for ( auto& upd: UpdatedConcepts )
+		if ( isValid(upd.first->pName) )	// fresh concepts are done already
+			Updated.push_back(upd);
+	for ( auto& upd: Updated )
+	{
+		TConcept* C = upd.first;
+		Changed.push_back(C);
+		if ( upd.second )
+		{
+			C->initToldSubsumers();
+			C->setToldTop(pTop);
+		}
+		else
+			C->addToldSubsumers(C->Description);
+	}
+
+	// told cycles are transformed into synonyms during preprocessing, so the KB has to be reloaded
+	for ( auto& C: Changed )
+	{
+		std::set<const ClassifiableEntry*> visited;
+		if ( isToldSubsumer ( C, C, visited ) )
+			throw EFaCTPlusPlus("FaCT++ Kernel: told cycle in the TBox update");
+	}
+
+	// translate new descriptions; fresh concepts might be translated as a part of the other ones
+	for ( auto& upd: Updated )
+	{
+		TConcept* C = upd.first;
+		BipolarPointer desc = C->Description == nullptr ? bpTOP : tree2dag(C->Description);
+		C->pBody = upd.second ? desc : and2dag ( C->pBody, desc );
+		DLHeap[C->pName].setChild(C->pBody);
+	}
+	for ( auto pc = c_begin() + static_cast<long>(nOldConcepts); pc != c_end(); ++pc )
+		concept2dag(*pc);
+	for ( auto& C: Changed )
+		C->removeDescription();
+
+	// keep new DAG entries when the query is removed
+	DLHeap.setFinalSize();
+	// new descriptions might join some sorts
+	determineSorts();
+
+	// the tags of the changed concepts and of their told descendants depend on the new told subsumers
+	std::map<const TConcept*, bool> Known;
+	for ( auto& C: Changed )
+		Known[C] = true;
+	ConceptVector Retag;
+	for ( c_iterator pc = c_begin(); pc != c_end(); ++pc )
+		if ( hasChangedToldSubsumer ( *pc, Known ) )
+		{
+			(*pc)->classTag = cttUnspecified;
+			(*pc)->tsDepth = 0;
+			Retag.push_back(*pc);
+		}
+	for ( auto& C: Retag )
+	{
+		C->getClassTag();
+		C->calculateTSDepth();
+	}
+
+	// new descriptions might add features to the changed concepts and to the ones that refer to them
+	// (fresh concepts are referred only by the changed ones); the features of the removed descriptions are kept
+	bool newFeatures = false;
+	for ( size_t i = 0; i < Changed.size(); ++i )
+	{
+		unsigned long old = Changed[i]->posFeatures.getAllFlags();
+		setConceptRelevant(Changed[i]);
+		newFeatures |= i >= nFresh && old != Changed[i]->posFeatures.getAllFlags();
+	}
+	if ( newFeatures )
+		for ( c_iterator pc = c_begin(); pc != c_end(); ++pc )
+			if ( isValid((*pc)->pName) )
+				setConceptRelevant(*pc);
+	curFeature = nullptr;
+	if ( KBFeatures.hasTopRole() )
+		useSortedReasoning = false;
+
+	// reasoners are built wrt the number of concepts
+	if ( nFresh > 0 && reasonersInited() )
+	{
+		delete stdReasoner;
+		delete nomReasoner;
+		stdReasoner = nomReasoner = nullptr;
+		initReasoner();
+	}
+
+	// the caches of the changed concepts are invalid, and so are the ones of every entry that refers to them
+	DLHeap.clearCaches();
+	KBStatus status = Status;
+	setConsistency(performConsistencyCheck());
+	if ( Consistent )
+		Status = status;
+	UpdatedConcepts.clear();
+
+	pt.Stop();
+	consistTime = pt;
+	if ( LLM.isWritable(llSatResult) )
+		LL << "\nTBox update of " << Changed.size() << " concepts is done in " << pt << " seconds";
+}
+
 bool
 TBox :: isSatisfiable ( const TConcept* pConcept )
 {
@@ -364,9 +826,7 @@ TBox :: isDisjointRoles ( const TRole* R, const TRole* S )
 	if ( R->isDataRole() != S->isDataRole() )
 		return true;
 	// prepare feature that are KB features
-	// FIXME!! overkill, but fine for now as it is sound
-	curFeature = &KBFeatures;
-	getReasoner()->setBlockingMethod ( isIRinQuery(), isNRinQuery() );
+	prepareKBFeatures();
 	bool result = getReasoner()->checkDisjointRoles ( R, S );
 	clearFeatures();
 	return result;
@@ -382,9 +842,7 @@ TBox :: isIrreflexive ( const TRole* R )
 	if ( R->isDataRole() )
 		return true;
 	// prepare feature that are KB features
-	// FIXME!! overkill, but fine for now as it is sound
-	curFeature = &KBFeatures;
-	getReasoner()->setBlockingMethod ( isIRinQuery(), isNRinQuery() );
+	prepareKBFeatures();
 	bool result = getReasoner()->checkIrreflexivity(R);
 	clearFeatures();
 	return result;
@@ -403,6 +861,11 @@ void TBox :: readConfig ( const ifOptionSet* Options )
 
 	// TBox options
 	addBoolOption(useCompletelyDefined);
+	addBoolOption(useCachedBottomUp);
+	addBoolOption(useTaxonomyIndex);
+	addBoolOption(useIndividualBatching);
+	addBoolOption(useInstanceIndex);
+	addBoolOption(useABoxPartitioning);
 	addBoolOption(dumpQuery);
 	addBoolOption(alwaysPreferEquals);
 	addBoolOption(useSpecialDomains);
@@ -540,9 +1003,35 @@ TBox :: writeReasoningResult ( std::ostream& o, float time ) const
 		f = 0;
 	f = ((unsigned long)(f*100))/100.f;
 	o << f << " seconds\n";
+	if ( pTaxCreator != nullptr )
+		pTaxCreator->printPhaseStatistic(o);
+	if ( pInstIndex != nullptr )
+		pInstIndex->print(o);
+	if ( pDataIndex != nullptr )
+		pDataIndex->print(o);
+	if ( nABoxComponents > 1 )
+		o << "ABox consists of " << nABoxComponents << " role-connected components; the largest one has "
+		  << maxABoxComponent << " individuals\n";
 	Print(o);
 }
 
+const InstanceIndex*
+TBox :: getInstanceIndex ( void )
+{
+	if ( !useInstanceIndex || Status < kbRealised || pTax == nullptr )
+		return nullptr;
+	if ( pInstIndex == nullptr )
+		pInstIndex = new InstanceIndex(pTax);
+	return pInstIndex;
+}
+
+void
+TBox :: buildDataValueIndex ( void )
+{
+	delete pDataIndex;
+	pDataIndex = new DataValueIndex(ToldDataValues);
+}
+
 void TBox :: PrintDagEntry ( std::ostream& o, BipolarPointer p ) const
 {
 	fpp_assert ( isValid (p) );
@@ -39,10 +39,12 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "DataTypeCenter.h"
 #include "tProgressMonitor.h"
 #include "tKBFlags.h"
+#include "DataValueIndex.h"
 
 class DlSatTester;
 class Taxonomy;
 class DLConceptTaxonomy;
+class InstanceIndex;
 class dumpInterface;
 class TSignature;
 class SaveLoadManager;
@@ -150,6 +152,12 @@ protected:	// members
 	DlSatTester* stdReasoner = nullptr;
 		/// reasoner for TBox-related queries with nominals
 	DlSatTester* nomReasoner = nullptr;
+		/// reasoners for the independent parts of the ABox; used instead of the NOMREASONER while it is not checked
+	std::vector<DlSatTester*> ABoxPartReasoners;
+		/// ABox part reasoner for every individual
+	std::map<const TConcept*, DlSatTester*> Ind2PartReasoner;
+		/// nominal reasoner for the current reasoning session; NULL means NOMREASONER
+	DlSatTester* curNomReasoner = nullptr;
 
 		/// progress monitor
 	TProgressMonitor* pMonitor = nullptr;
@@ -160,6 +168,12 @@ protected:	// members
 	Taxonomy* pTax = nullptr;
 		/// classifier
 	DLConceptTaxonomy* pTaxCreator = nullptr;
+		/// concept -> instances index over the realised taxonomy
+	InstanceIndex* pInstIndex = nullptr;
+		/// told data assertions of the ABox
+	DataValueIndex::ToldValueVec ToldDataValues;
+		/// data role -> values index over the told data assertions of a realised KB
+	DataValueIndex* pDataIndex = nullptr;
 		/// name-signature map
 	NameSigMap* pName2Sig = nullptr;
 		/// DataType center
@@ -272,6 +286,16 @@ protected:	// members
 
 		/// flag for creating taxonomy
 	bool useCompletelyDefined = true;
+		/// flag for checking BU candidates via cached models before the tableau
+	bool useCachedBottomUp = true;
+		/// flag for building an index of the concept taxonomy
+	bool useTaxonomyIndex = false;
+		/// flag for classifying indistinguishable individuals only once
+	bool useIndividualBatching = true;
+		/// flag for building instance index after realisation
+	bool useInstanceIndex = false;
+		/// flag for reasoning over the role-connected ABox components separately
+	bool useABoxPartitioning = false;
 		/// flag for dumping TBox relevant to query
 	bool dumpQuery = false;
 		/// whether or not we need classification. Set up in checkQueryNames()
@@ -301,6 +325,16 @@ protected:	// members
 	float preprocTime = 0.0;
 		/// time spend for consistency checking
 	float consistTime = 0.0;
+		/// number of role-connected ABox components
+	size_t nABoxComponents = 0;
+		/// size of the largest ABox component
+	size_t maxABoxComponent = 0;
+		/// individuals touched by the ABox assertions added after preprocessing
+	std::set<TIndividual*> UpdatedIndividuals;
+		/// concepts with told subsumptions changed after classification; true if they were replaced, not extended
+	std::map<TConcept*, bool> UpdatedConcepts;
+		/// number of concepts before the TBox update; the ones after that are fresh
+	size_t nOldConcepts = 0;
 
 protected:	// methods
 		/// init all flags using given set of options
@@ -435,6 +469,8 @@ protected:	// methods
 	}
 		/// create node for AND expression T
 	BipolarPointer and2dag ( const DLTree* t );
+		/// create node for the conjunction of DAG entries P and Q
+	BipolarPointer and2dag ( BipolarPointer p, BipolarPointer q );
 		/// add elements of T to and-like vertex V; @return true if clash occurs
 	bool fillANDVertex ( DLVertex* v, const DLTree* t );
 		/// create forall node for data role
@@ -660,7 +696,7 @@ protected:	// methods
 	{
 		fpp_assert ( curFeature != nullptr );
 		if ( curFeature->hasSingletons() )
-			return nomReasoner;
+			return curNomReasoner != nullptr ? curNomReasoner : nomReasoner;
 		else
 			return stdReasoner;
 	}
@@ -669,12 +705,24 @@ protected:	// methods
 	{
 		fpp_assert ( curFeature != nullptr );
 		if ( curFeature->hasSingletons() )
-			return nomReasoner;
+			return curNomReasoner != nullptr ? curNomReasoner : nomReasoner;
 		else
 			return stdReasoner;
 	}
 		/// check whether KB is consistent; @return true if it is
 	bool performConsistencyCheck ( void );	// implemented in Reasoner.h
+		/// split individuals into the components connected by RELATED and DIFFERENT axioms
+	void buildABoxComponents ( std::vector<SingletonVector>& Components ) const;
+		/// split the ABox into independent parts with their own reasoners; @return false if there is only one part
+	bool initABoxParts ( void );
+		/// check every ABox part in isolation; @return false if one of them is inconsistent
+	bool consistentABoxParts ( void );
+		/// build the whole nominal cloud in the NOMREASONER (all ABox parts are consistent); drop the part reasoners
+	void checkWholeNominalCloud ( void );
+		/// delete the reasoners of the ABox parts
+	void clearABoxParts ( void );
+		/// put an individual I touched by the ABox update into the DAG; set its classification info
+	void preprocessUpdatedIndividual ( TIndividual* I );
 
 //-----------------------------------------------------------------------------
 //--		internal reasoning interface
@@ -686,6 +734,8 @@ protected:	// methods
 	void initTaxonomy ( void );				// implemented in DLConceptTaxonomy.h
 		/// set NameSigMap
 	void setNameSigMap ( NameSigMap* p ) { pName2Sig = p; }
+		/// @return true iff NameSigMap is set
+	bool hasNameSigMap ( void ) const { return pName2Sig != nullptr; }
 		/// creating taxonomy for given TBox; include individuals if necessary
 	void createTaxonomy ( bool needIndividuals );
 		/// partition all elements in [begin,end) range wtr their tags
@@ -884,8 +934,12 @@ protected:	// methods
 	}
 		/// prepare features for SAT(P), or SUB(P,Q) test
 	void prepareFeatures ( const TConcept* pConcept, const TConcept* qConcept );
+		/// prepare features of the whole KB for a role test
+	void prepareKBFeatures ( void );
+		/// make sure the reasoner for the current features is ready: a test that needs all the nominals checks the whole cloud
+	void prepareReasoner ( void );
 		/// clear current features
-	void clearFeatures ( void ) { curFeature = nullptr; }
+	void clearFeatures ( void ) { curFeature = nullptr; curNomReasoner = nullptr; }
 
 //-----------------------------------------------------------------------------
 //--		internal dump output interface
@@ -1039,6 +1093,8 @@ public:
 	void addSubsumeForDefined ( TConcept* C, DLTree* E );
 		/// add an axiom LHS = RHS
 	void addEqualityAxiom ( DLTree* lhs, DLTree* rhs );
+		/// remember all the told data assertions R(I,V) of the form I:ER.V in the description C for the data value index
+	void addToldDataValues ( const TIndividual* I, const DLTree* C );
 
 		/// add simple rule RULE to the TBox' rules
 	inline
@@ -1172,6 +1228,12 @@ public:
 
 		/// get (READ-WRITE) access to internal Taxonomy of concepts
 	Taxonomy* getTaxonomy ( void ) { return pTax; }
+		/// get the instance index of a realised KB; build it if necessary. @return NULL if index is not in use
+	const InstanceIndex* getInstanceIndex ( void );
+		/// get the data value index of a realised KB. @return NULL if KB is not realised
+	const DataValueIndex* getDataValueIndex ( void ) const { return pDataIndex; }
+		/// build the data value index over the told data assertions; done at the end of realisation
+	void buildDataValueIndex ( void );
 
 		/// set given structure as a progress monitor
 	void setProgressMonitor ( TProgressMonitor* pMon ) { pMonitor = pMon; }
@@ -1214,6 +1276,42 @@ public:
 		}
 		return Consistent;
 	}
+
+	// ABox update: add new assertions to the preprocessed KB
+
+		/// @return true iff new ABox assertions might be added to the KB without reloading it
+	bool canUpdateABox ( void ) const
+		{ return Status >= kbCChecked && Consistent && nNominalReferences == 0 && nomReasoner != nullptr; }
+		/// prepare the preprocessed KB to the new ABox assertions
+	void startABoxUpdate ( void );
+		/// add assertion I:C to the KB; @return false (with the KB unchanged) if it can't be done without reload
+	bool addInstanceAssertion ( TIndividual* I, DLTree* C );
+		/// add assertion R(I,J) to the KB; @return false (with the KB unchanged) if it can't be done without reload
+	bool addRelatedAssertion ( TIndividual* I, TRole* R, TIndividual* J );
+		/// preprocess the new assertions and re-check the consistency
+	void finishABoxUpdate ( void );
+
+	// TBox update: change told subsumptions of primitive concepts in the classified KB
+
+		/// @return true iff told subsumptions of primitive concepts might be changed without reloading the KB
+	bool canUpdateTBox ( void ) const
+	{
+		return Status >= kbClassified && Consistent && pTax != nullptr && nNominalReferences == 0
+			&& i_begin() == i_end() && countSynonyms() == 0;
+	}
+		/// prepare the classified KB to the changes of told subsumptions; fresh concepts are allowed
+	void startTBoxUpdate ( void );
+		/// add told subsumption C [= D to the KB
+	void addToldSubsumption ( TConcept* C, DLTree* D );
+		/// remove all told subsumptions of C from the KB; the remaining ones should be added again
+	void clearToldSubsumptions ( TConcept* C )
+	{
+		C->removeDescription();
+		UpdatedConcepts[C] = true;
+	}
+		/// preprocess the changed and fresh concepts and re-check the consistency; throw on told cycles
+	void finishTBoxUpdate ( void );
+
 		/// check if a subsumption C [= D holds
 	bool isSubHolds ( const TConcept* C, const TConcept* D );
 		/// check if a concept C is satisfiable
@@ -114,6 +114,14 @@ public:		// interface
 		else
 			nCache = p;
 	}
+		/// remove both caches
+	void clearCache ( void )
+	{
+		delete pCache;
+		pCache = nullptr;
+		delete nCache;
+		nCache = nullptr;
+	}
 }; // DLVertexCache
 
 class DLVertexStatistic
@@ -241,6 +241,12 @@ public:		// methods
 		if ( Description != nullptr )	// init (additional) told subsumers from definition
 			CD &= initToldSubsumers(Description);
 		setCompletelyDefined(CD);
+	}
+		/// add told subsumers from the extra description DESC of a primitive concept
+	void addToldSubsumers ( const DLTree* desc )
+	{
+		bool CD = initToldSubsumers(desc);
+		setCompletelyDefined ( CD && isCompletelyDefined() );
 	}
 		/// init TOP told subsumer if necessary
 	void setToldTop ( TConcept* top )
@@ -162,6 +162,8 @@ protected:	// members
 	const TDataEntry* Type;
 		/// DAG index of the entry
 	BipolarPointer pName;
+		/// index of the basic data type in the DataTypeCenter; used only for types
+	unsigned int typeIndex = 0;
 		/// ComparableDT, used only for values
 	ComparableDT comp;
 		/// restriction to the entry
@@ -212,6 +214,10 @@ public:		// interface
 	void setHostType ( const TDataEntry* type ) { Type = type; setComp(type->getName()); }
 		/// get host type
 	const TDataEntry* getType ( void ) const { return Type; }
+		/// set the index of the basic data type
+	void setTypeIndex ( unsigned int index ) { typeIndex = index; }
+		/// get the index of the basic data type
+	unsigned int getTypeIndex ( void ) const { return typeIndex; }
 
 		/// get comparable variant of DE
 	const ComparableDT& getComp ( void ) const { return comp; }
@@ -28,8 +28,6 @@ TExpressionManager :: TExpressionManager ( void )
 	, ORBottom(new TDLObjectRoleBottom)
 	, DRTop(new TDLDataRoleTop)
 	, DRBottom(new TDLDataRoleBottom)
-	, InverseRoleCache(this)
-	, OneOfCache(this)
 {
 }
 
@@ -54,8 +52,7 @@ TExpressionManager :: clear ( void )
 	NS_I.clear();
 	NS_OR.clear();
 	NS_DR.clear();
-	InverseRoleCache.clear();
-	OneOfCache.clear();
+	ExprCache.clear();
 	// delete all the recorded references
 	for ( auto& expr: RefRecorder )
 		delete expr;
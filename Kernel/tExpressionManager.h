@@ -20,52 +20,45 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef TEXPRESSIONMANAGER_H
 #define TEXPRESSIONMANAGER_H
 
+#include <typeindex>
+#include <unordered_map>
+
 #include "tDLExpression.h"
 #include "tNameSet.h"
 #include "tNAryQueue.h"
 #include "tDataTypeManager.h"
-#include "tHeadTailCache.h"
 
 /// manager to work with all DL expressions in the kernel
 class TExpressionManager
 {
 protected:	// types
-		/// cache for the one-of expressions
-	class TOneOfCache: public THeadTailCache<TDLConceptExpression, const TDLIndividualExpression>
+		/// arguments of an expression: sub-expressions (that are already shared) in their order
+	typedef std::vector<const TDLExpression*> TExprArgs;
+		/// structural key of an expression: its class, its number (if any) and its arguments
+	struct TExprKey
 	{
-	protected:	// members
-			/// host expression manager
-		TExpressionManager* pManager;
-
-	protected:	// methods
-			/// the way to create an object by a given tail
-		TDLConceptExpression* build ( const TDLIndividualExpression* tail ) override;
-
-	public:		// interface
-			/// empty c'tor
-		explicit TOneOfCache ( TExpressionManager* p ) : THeadTailCache<TDLConceptExpression, const TDLIndividualExpression>(), pManager(p) {}
-
-			/// clear the cache
-		void clear ( void ) { Map.clear(); }
-	}; // TOneOfCache
-		/// Cache for the inverse roles
-	class TInverseRoleCache : public THeadTailCache<TDLObjectRoleExpression, const TDLObjectRoleExpression>
+		std::type_index Type;
+		unsigned int n;
+		TExprArgs Args;
+
+			/// init c'tor
+		TExprKey ( const std::type_info& type, unsigned int num, const TExprArgs& args ) : Type(type), n(num), Args(args) {}
+			/// equality of the keys
+		bool operator == ( const TExprKey& key ) const { return Type == key.Type && n == key.n && Args == key.Args; }
+	}; // TExprKey
+		/// hash of the structural key
+	struct TExprKeyHash
 	{
-	protected:	// members
-			/// host expression manager
-		TExpressionManager* pManager;
-
-	protected:	// methods
-			/// the way to create an object by a given tail
-		TDLObjectRoleExpression* build ( const TDLObjectRoleExpression* tail ) override;
-
-	public:		// interface
-			/// empty c'tor
-		explicit TInverseRoleCache ( TExpressionManager* p ) : THeadTailCache<TDLObjectRoleExpression, const TDLObjectRoleExpression>(), pManager(p) {}
-
-			/// clear the cache
-		void clear ( void ) { Map.clear(); }
-	}; // TInverseRoleCache
+		size_t operator() ( const TExprKey& key ) const
+		{
+			size_t h = key.Type.hash_code() ^ key.n;
+			for ( const TDLExpression* arg: key.Args )
+				h = h * 31 + std::hash<const TDLExpression*>()(arg);
+			return h;
+		}
+	}; // TExprKeyHash
+		/// map from the structure of an expression to the expression itself
+	typedef std::unordered_map<TExprKey, TDLExpression*, TExprKeyHash> TExprCache;
 
 protected:	// members
 		/// nameset for concepts
@@ -102,15 +95,32 @@ protected:	// members
 		/// record all the references
 	std::vector<TDLExpression*> RefRecorder;
 
-		/// cache for the role inverses
-	TInverseRoleCache InverseRoleCache;
-		/// cache for the one-of singletons
-	TOneOfCache OneOfCache;
+		/// all the complex expressions by their structure; structurally equal expressions are built only once
+	TExprCache ExprCache;
 
 protected:	// methods
 		/// record the reference; @return the argument
 	template <typename T>
 	T* record ( T* arg ) { RefRecorder.push_back(arg); return arg; }
+		/// @return an expression of the class T with the number N and arguments ARGS; create it by T(ctorArgs) if necessary
+	template <typename T, typename... CtorArgs>
+	T* share ( unsigned int n, const TExprArgs& args, CtorArgs&&... ctorArgs )
+	{
+		TExprKey key ( typeid(T), n, args );
+		auto p = ExprCache.find(key);
+		if ( p != ExprCache.end() )
+			return static_cast<T*>(p->second);
+		T* ret = record(new T(std::forward<CtorArgs>(ctorArgs)...));
+		ExprCache.emplace ( std::move(key), ret );
+		return ret;
+	}
+		/// @return an n-ary expression of the class T with the arguments from the last argument list
+	template <typename T>
+	T* shareNAry ( void )
+	{
+		const TExprArgs& args = getArgList();
+		return share<T> ( 0, args, args );
+	}
 
 public:		// interface
 		/// empty c'tor
@@ -176,73 +186,71 @@ public:		// interface
 	TDLConceptBottom* Bottom ( void ) const { return CBottom; }
 		/// get named concept
 	TDLConceptName* Concept ( const std::string& name ) { return NS_C.insert(name); }
+		/// get named concept by a C string
+	TDLConceptName* Concept ( const char* name ) { return NS_C.insert(name); }
 		/// get negation of a concept C
-	TDLConceptExpression* Not ( const TDLConceptExpression* C ) { return record(new TDLConceptNot(C)); }
+	TDLConceptExpression* Not ( const TDLConceptExpression* C ) { return share<TDLConceptNot> ( 0, { C }, C ); }
 		/// get an n-ary conjunction expression; take the arguments from the last argument list
-	TDLConceptExpression* And ( void ) { return record(new TDLConceptAnd(getArgList())); }
+	TDLConceptExpression* And ( void ) { return shareNAry<TDLConceptAnd>(); }
 		/// @return C and D
 	TDLConceptExpression* And ( const TDLConceptExpression* C, const TDLConceptExpression* D )
 		{ newArgList(); addArg(C); addArg(D); return And(); }
 		/// get an n-ary disjunction expression; take the arguments from the last argument list
-	TDLConceptExpression* Or ( void ) { return record(new TDLConceptOr(getArgList())); }
+	TDLConceptExpression* Or ( void ) { return shareNAry<TDLConceptOr>(); }
 		/// @return C or D
 	TDLConceptExpression* Or ( const TDLConceptExpression* C, const TDLConceptExpression* D )
 		{ newArgList(); addArg(C); addArg(D); return Or(); }
 		/// get an n-ary one-of expression; take the arguments from the last argument list
-	TDLConceptExpression* OneOf ( void )
-	{
-		auto& v = getArgList();
-		if ( v.size() == 1 )
-			return OneOfCache.get(static_cast<const TDLIndividualExpression*>(v.front()));
-		return record(new TDLConceptOneOf(v));
-	}
+	TDLConceptExpression* OneOf ( void ) { return shareNAry<TDLConceptOneOf>(); }
 		/// @return concept {I} for the individual I
-	TDLConceptExpression* OneOf ( const TDLIndividualExpression* I ) { return OneOfCache.get(I); }
+	TDLConceptExpression* OneOf ( const TDLIndividualExpression* I ) { TExprArgs args { I }; return share<TDLConceptOneOf> ( 0, args, args ); }
 
 		/// get self-reference restriction of an object role R
-	TDLConceptExpression* SelfReference ( const TDLObjectRoleExpression* R ) { return record(new TDLConceptObjectSelf(R)); }
+	TDLConceptExpression* SelfReference ( const TDLObjectRoleExpression* R ) { return share<TDLConceptObjectSelf> ( 0, { R }, R ); }
 		/// get value restriction wrt an object role R and an individual I
 	TDLConceptExpression* Value ( const TDLObjectRoleExpression* R, const TDLIndividualExpression* I )
-		{ return record(new TDLConceptObjectValue(R,I)); }
+		{ return share<TDLConceptObjectValue> ( 0, { R, I }, R, I ); }
 		/// get existential restriction wrt an object role R and a concept C
 	TDLConceptExpression* Exists ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectExists(R,C)); }
+		{ return share<TDLConceptObjectExists> ( 0, { R, C }, R, C ); }
 		/// get universal restriction wrt an object role R and a concept C
 	TDLConceptExpression* Forall ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectForall(R,C)); }
+		{ return share<TDLConceptObjectForall> ( 0, { R, C }, R, C ); }
 		/// get min cardinality restriction wrt number N, an object role R and a concept C
 	TDLConceptExpression* MinCardinality ( unsigned int n, const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectMinCardinality(n,R,C)); }
+		{ return share<TDLConceptObjectMinCardinality> ( n, { R, C }, n, R, C ); }
 		/// get max cardinality restriction wrt number N, an object role R and a concept C
 	TDLConceptExpression* MaxCardinality ( unsigned int n, const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectMaxCardinality(n,R,C)); }
+		{ return share<TDLConceptObjectMaxCardinality> ( n, { R, C }, n, R, C ); }
 		/// get exact cardinality restriction wrt number N, an object role R and a concept C
 	TDLConceptExpression* Cardinality ( unsigned int n, const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectExactCardinality(n,R,C)); }
+		{ return share<TDLConceptObjectExactCardinality> ( n, { R, C }, n, R, C ); }
 
 		/// get value restriction wrt a data role R and a data value V
 	TDLConceptExpression* Value ( const TDLDataRoleExpression* R, const TDLDataValue* V )
-		{ return record(new TDLConceptDataValue(R,V)); }
+		{ return share<TDLConceptDataValue> ( 0, { R, V }, R, V ); }
 		/// get existential restriction wrt a data role R and a data expression E
 	TDLConceptExpression* Exists ( const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataExists(R,E)); }
+		{ return share<TDLConceptDataExists> ( 0, { R, E }, R, E ); }
 		/// get universal restriction wrt a data role R and a data expression E
 	TDLConceptExpression* Forall ( const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataForall(R,E)); }
+		{ return share<TDLConceptDataForall> ( 0, { R, E }, R, E ); }
 		/// get min cardinality restriction wrt number N, a data role R and a data expression E
 	TDLConceptExpression* MinCardinality ( unsigned int n, const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataMinCardinality(n,R,E)); }
+		{ return share<TDLConceptDataMinCardinality> ( n, { R, E }, n, R, E ); }
 		/// get max cardinality restriction wrt number N, a data role R and a data expression E
 	TDLConceptExpression* MaxCardinality ( unsigned int n, const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataMaxCardinality(n,R,E)); }
+		{ return share<TDLConceptDataMaxCardinality> ( n, { R, E }, n, R, E ); }
 		/// get exact cardinality restriction wrt number N, a data role R and a data expression E
 	TDLConceptExpression* Cardinality ( unsigned int n, const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataExactCardinality(n,R,E)); }
+		{ return share<TDLConceptDataExactCardinality> ( n, { R, E }, n, R, E ); }
 
 	// individuals
 
 		/// get named individual
 	TDLIndividualName* Individual ( const std::string& name ) { return NS_I.insert(name); }
+		/// get named individual by a C string
+	TDLIndividualName* Individual ( const char* name ) { return NS_I.insert(name); }
 
 	// object roles
 
@@ -252,16 +260,18 @@ public:		// interface
 	TDLObjectRoleExpression* ObjectRoleBottom ( void ) const { return ORBottom; }
 		/// get named object role
 	TDLObjectRoleName* ObjectRole ( const std::string& name ) { return NS_OR.insert(name); }
+		/// get named object role by a C string
+	TDLObjectRoleName* ObjectRole ( const char* name ) { return NS_OR.insert(name); }
 		/// get an inverse of a given object role expression R
-	TDLObjectRoleExpression* Inverse ( const TDLObjectRoleExpression* R ) { return InverseRoleCache.get(R); }
+	TDLObjectRoleExpression* Inverse ( const TDLObjectRoleExpression* R ) { return share<TDLObjectRoleInverse> ( 0, { R }, R ); }
 		/// get a role chain corresponding to R1 o ... o Rn; take the arguments from the last argument list
-	TDLObjectRoleComplexExpression* Compose ( void ) { return record(new TDLObjectRoleChain(getArgList())); }
+	TDLObjectRoleComplexExpression* Compose ( void ) { return shareNAry<TDLObjectRoleChain>(); }
 		/// get a expression corresponding to R projected from C
 	TDLObjectRoleComplexExpression* ProjectFrom ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLObjectRoleProjectionFrom(R,C)); }
+		{ return share<TDLObjectRoleProjectionFrom> ( 0, { R, C }, R, C ); }
 		/// get a expression corresponding to R projected into C
 	TDLObjectRoleComplexExpression* ProjectInto ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLObjectRoleProjectionInto(R,C)); }
+		{ return share<TDLObjectRoleProjectionInto> ( 0, { R, C }, R, C ); }
 
 	// data roles
 
@@ -271,6 +281,8 @@ public:		// interface
 	TDLDataRoleExpression* DataRoleBottom ( void ) const { return DRBottom; }
 		/// get named data role
 	TDLDataRoleName* DataRole ( const std::string& name ) { return NS_DR.insert(name); }
+		/// get named data role by a C string
+	TDLDataRoleName* DataRole ( const char* name ) { return NS_DR.insert(name); }
 
 	// data expressions
 
@@ -281,6 +293,8 @@ public:		// interface
 
 		/// get named data type
 	TDLDataTypeName* DataType ( const std::string& name ) { return NS_DT.insert(name); }
+		/// get named data type by a C string
+	TDLDataTypeName* DataType ( const char* name ) { return NS_DT.insert(name); }
 		/// get basic string data type
 	TDLDataTypeName* getStrDataType ( void ) { return DataType(TDataTypeManager::getStrTypeName()); }
 		/// get basic integer data type
@@ -311,38 +325,23 @@ public:		// interface
 		// That is, value of a type positiveInteger will be of a type Integer
 	const TDLDataValue* DataValue ( const std::string& value, TDLDataTypeExpression* type ) { return getBasicDataType(type)->getValue(value); }
 		/// get negation of a data expression E
-	TDLDataExpression* DataNot ( const TDLDataExpression* E ) { return record(new TDLDataNot(E)); }
+	TDLDataExpression* DataNot ( const TDLDataExpression* E ) { return share<TDLDataNot> ( 0, { E }, E ); }
 		/// get an n-ary data conjunction expression; take the arguments from the last argument list
-	TDLDataExpression* DataAnd ( void ) { return record(new TDLDataAnd(getArgList())); }
+	TDLDataExpression* DataAnd ( void ) { return shareNAry<TDLDataAnd>(); }
 		/// get an n-ary data disjunction expression; take the arguments from the last argument list
-	TDLDataExpression* DataOr ( void ) { return record(new TDLDataOr(getArgList())); }
+	TDLDataExpression* DataOr ( void ) { return shareNAry<TDLDataOr>(); }
 		/// get an n-ary data one-of expression; take the arguments from the last argument list
-	TDLDataExpression* DataOneOf ( void ) { return record(new TDLDataOneOf(getArgList())); }
+	TDLDataExpression* DataOneOf ( void ) { return shareNAry<TDLDataOneOf>(); }
 
 		/// get minInclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMinInclusive ( const TDLDataValue* V ) { return record(new TDLFacetMinInclusive(V)); }
+	const TDLFacetExpression* FacetMinInclusive ( const TDLDataValue* V ) { return share<TDLFacetMinInclusive> ( 0, { V }, V ); }
 		/// get minExclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMinExclusive ( const TDLDataValue* V ) { return record(new TDLFacetMinExclusive(V)); }
+	const TDLFacetExpression* FacetMinExclusive ( const TDLDataValue* V ) { return share<TDLFacetMinExclusive> ( 0, { V }, V ); }
 		/// get maxInclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMaxInclusive ( const TDLDataValue* V ) { return record(new TDLFacetMaxInclusive(V)); }
+	const TDLFacetExpression* FacetMaxInclusive ( const TDLDataValue* V ) { return share<TDLFacetMaxInclusive> ( 0, { V }, V ); }
 		/// get maxExclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMaxExclusive ( const TDLDataValue* V ) { return record(new TDLFacetMaxExclusive(V)); }
+	const TDLFacetExpression* FacetMaxExclusive ( const TDLDataValue* V ) { return share<TDLFacetMaxExclusive> ( 0, { V }, V ); }
 
 }; // TExpressionManager
 
-inline TDLObjectRoleExpression*
-TExpressionManager::TInverseRoleCache::build ( const TDLObjectRoleExpression* tail )
-{
-	return pManager->record(new TDLObjectRoleInverse(tail));
-}
-
-inline TDLConceptExpression*
-TExpressionManager::TOneOfCache::build ( const TDLIndividualExpression* tail )
-{
-	pManager->newArgList();
-	pManager->addArg(tail);
-	return pManager->record(new TDLConceptOneOf(pManager->getArgList()));
-}
-
-
 #endif
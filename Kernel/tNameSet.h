@@ -21,7 +21,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define TNAMESET_H
 
 #include <string>
-#include <map>
+#include <cstring>
+#include <unordered_map>
 
 /// base class for creating Named Entries; template parameter should be derived from TNamedEntry
 template <typename T>
@@ -38,13 +39,45 @@ public:		// interface
 }; // TNameCreator
 
 
-/// Implementation of NameSets by binary trees; template parameter should be derived from TNamedEntry
+/// non-owning reference to the name bytes; used as a key in the name sets
+class TNameKey
+{
+protected:	// members
+		/// start of the name
+	const char* str;
+		/// length of the name
+	size_t len;
+
+public:		// interface
+		/// init c'tor
+	TNameKey ( const char* s, size_t l ) : str(s), len(l) {}
+
+		/// equality of the keys
+	bool operator == ( const TNameKey& key ) const { return len == key.len && memcmp ( str, key.str, len ) == 0; }
+
+		/// FNV-1a hash of the name bytes
+	struct Hash
+	{
+		size_t operator() ( const TNameKey& key ) const
+		{
+			unsigned long long h = 14695981039346656037ULL;
+			for ( const char *p = key.str, *p_end = key.str + key.len; p != p_end; ++p )
+				h = ( h ^ (unsigned char)*p ) * 1099511628211ULL;
+			return (size_t)h;
+		}
+	}; // Hash
+}; // TNameKey
+
+
+/// Implementation of NameSets by hash tables; template parameter should be derived from TNamedEntry.
+/// The keys refer to the names kept in the entries themselves, so every name is stored only once
+/// and the lookups by a C string do not create a std::string
 template <typename T>
 class TNameSet
 {
 protected:	// types
 		/// base type
-	typedef std::map <std::string, T*> NameTree;
+	typedef std::unordered_map <TNameKey, T*, TNameKey::Hash> NameTree;
 
 protected:	// members
 		/// Base holding all names
@@ -52,6 +85,10 @@ protected:	// members
 		/// creator of new name
 	TNameCreator<T>* Creator;
 
+protected:	// methods
+		/// @return key that refers to the name of the entry P
+	static TNameKey keyOf ( const T* p ) { return TNameKey ( p->getName(), strlen(p->getName()) ); }
+
 public:		// interface
 		/// c'tor (empty)
 	TNameSet() : Creator(new TNameCreator<T>) {}
@@ -65,20 +102,34 @@ public:		// interface
 	virtual ~TNameSet() { clear(); delete Creator; }
 
 		/// return pointer to existing id or NULL if no such id defined
-	T* get ( const std::string& id ) const
+	T* get ( const char* id, size_t len ) const
 	{
-		auto p = Base.find(id);
+		auto p = Base.find(TNameKey(id,len));
 		return p == Base.end() ? nullptr : p->second;
 	}
+		/// return pointer to existing id or NULL if no such id defined
+	T* get ( const std::string& id ) const { return get ( id.data(), id.size() ); }
+		/// return pointer to existing id or NULL if no such id defined
+	T* get ( const char* id ) const { return get ( id, strlen(id) ); }
 		/// unconditionally add new element with name ID to the set; return new element
 	T* add ( const std::string& id )
 	{
 		T* pne = Creator->makeEntry(id);
-		Base[id] = pne;
+		// the key should refer to the name of the new entry
+		Base.erase(TNameKey(id.data(),id.size()));
+		Base.emplace ( keyOf(pne), pne );
 		return pne;
 	}
 		/// Insert id to the nameset (if necessary); @return pointer to id structure created by external creator
 	T* insert ( const std::string& id )
+	{
+		T* pne = get(id);
+		if ( pne == nullptr )	// no such Id
+			pne = add(id);
+		return pne;
+	}
+		/// Insert id to the nameset (if necessary); create a std::string only for the new names
+	T* insert ( const char* id )
 	{
 		T* pne = get(id);
 		if ( pne == nullptr )	// no such Id
@@ -88,12 +139,13 @@ public:		// interface
 		/// remove given entry from the set
 	void remove ( const std::string& id )
 	{
-		auto p = Base.find(id);
+		auto p = Base.find(TNameKey(id.data(),id.size()));
 
 		if ( p != Base.end () )	// found such Id
 		{
-			delete p->second;
+			T* pne = p->second;
 			Base.erase(p);
+			delete pne;
 		}
 	}
 		/// clear name set
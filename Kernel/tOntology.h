@@ -20,6 +20,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef TONTOLOGY_H
 #define TONTOLOGY_H
 
+#include <algorithm>
 #include <vector>
 
 #include "globaldef.h"
@@ -46,6 +47,8 @@ protected:	// members
 	size_t axiomToProcess = 0;
 		/// true iff ontology was changed
 	bool changed = false;
+		/// number of additions and retractions made to the ontology
+	unsigned long long version = 0;
 
 public:		// interface
 		/// empty c'tor
@@ -55,6 +58,8 @@ public:		// interface
 
 		/// @return true iff the ontology was changed since its last load
 	bool isChanged ( void ) const { return changed; }
+		/// @return the number of changes made to the ontology; different values mean different sets of axioms
+	unsigned long long getVersion ( void ) const { return version; }
 		/// set the processed marker to the end of the ontology
 	void setProcessed ( void ) { axiomToProcess = Axioms.size(); Retracted.clear(); changed = false; }
 
@@ -64,18 +69,28 @@ public:		// interface
 		p->setId(++axiomId);
 		Axioms.push_back(p);
 		changed = true;
+		++version;
 		return p;
 	}
+		/// @return true iff the axiom P belongs to the ontology
+	bool contains ( const TDLAxiom* p ) const { return p->getId() > 0 && p->getId() <= Axioms.size() && Axioms[p->getId()-1] == p; }
 		/// retract given axiom to the ontology
 	void retract ( TDLAxiom* p )
 	{
-//		if ( p->getId() <= Axioms.size() && Axioms[p->getId()-1] == p )
+		changed = true;
+		Retracted.push_back(p);
+		// an axiom of another ontology is only recorded (to be rejected by the batch validation);
+		// disabling it would change its own ontology
+		if ( contains(p) )
 		{
-			changed = true;
+			++version;
 			p->setUsed(false);
-			Retracted.push_back(p);
 		}
 	}
+		/// cancel the retractions for which the predicate CANCEL holds; the cancelled axioms are not re-enabled
+	template<class Pred>
+	void cancelRetractions ( Pred cancel )
+		{ Retracted.erase ( std::remove_if ( Retracted.begin(), Retracted.end(), cancel ), Retracted.end() ); }
 		/// mark all the axioms as not in the module
 	void clearModuleInfo ( void )
 	{
@@ -99,6 +114,7 @@ public:		// interface
 		EManager.clear();
 		axiomToProcess = 0;
 		changed = false;
+		++version;
 	}
 
 		/// get access to an expression manager
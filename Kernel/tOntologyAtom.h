@@ -109,6 +109,8 @@ public:		// interface
 	const AxiomSet& getModule ( void ) const { return ModuleAxioms; }
 		/// get atoms a given one depends on
 	const AtomSet& getDepAtoms ( void ) const { return DepAtoms; }
+		/// get all the atoms a given one depends on; valid after the graph is reduced
+	const AtomSet& getAllDepAtoms ( void ) const { return AllDepAtoms; }
 
 		/// get the value of the id
     size_t getId() const { return Id; }
@@ -72,7 +72,7 @@ protected:	// methods
 	}
 		/// prepare arguments for the [begin,end) interval
 	template <typename Collection>
-	void prepareArgList ( Collection argList )
+	void prepareArgList ( const Collection& argList )
 	{
 		ArgList.clear();
 		for ( const auto& expr: argList )
@@ -312,9 +312,10 @@ public:		// visitor interface
 	{
 		ensureNames(axiom.getIndividual());
 		ensureNames(axiom.getC());
-		getIndividual ( axiom.getIndividual(), "Individual expected in Instance axiom" );
+		TIndividual* ind = getIndividual ( axiom.getIndividual(), "Individual expected in Instance axiom" );
 		DLTree* I = e(axiom.getIndividual());
 		DLTree* C = e(axiom.getC());
+		kb.addToldDataValues ( ind, C );
 		kb.addSubsumeAxiom ( I, C );
 	}
 	void visit ( const TDLAxiomRelatedTo& axiom ) override
@@ -352,15 +353,16 @@ public:		// visitor interface
 	{
 		ensureNames(axiom.getIndividual());
 		ensureNames(axiom.getAttribute());
-		getIndividual ( axiom.getIndividual(), "Individual expected in Value Of axiom" );
+		TIndividual* I = getIndividual ( axiom.getIndividual(), "Individual expected in Value Of axiom" );
 		// FIXME!! think about ensuring the value
 		TRole* R = getRole ( axiom.getAttribute(), "Role expression expected in Value Of axiom" );
 		if ( R->isBottom() )
 			throw EFPPInconsistentKB();
-		if ( !R->isTop() )	// nothing to do for universal role
-			kb.addSubsumeAxiom (	// make an axiom i:EA.V
-				e(axiom.getIndividual()),
-				createSNFExists ( e(axiom.getAttribute()), e(axiom.getValue())) );
+		if ( R->isTop() )	// nothing to do for universal role
+			return;
+		DLTree* C = createSNFExists ( e(axiom.getAttribute()), e(axiom.getValue()) );
+		kb.addToldDataValues ( I, C );
+		kb.addSubsumeAxiom ( e(axiom.getIndividual()), C );	// make an axiom i:EA.V
 	}
 	void visit ( const TDLAxiomValueOfNot& axiom ) override
 	{
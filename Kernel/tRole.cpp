@@ -238,7 +238,7 @@ public:
 
 /// init ancestors and descendants using Taxonomy
 void
-TRole :: initADbyTaxonomy ( Taxonomy* pTax, size_t nRoles )
+TRole :: initADbyTaxonomy ( Taxonomy* pTax, TRoleMatrix::Word* ancRow )
 {
 	fpp_assert ( isClassified() );	// safety check
 	fpp_assert ( Ancestor.empty() && Descendant.empty() );
@@ -252,20 +252,15 @@ TRole :: initADbyTaxonomy ( Taxonomy* pTax, size_t nRoles )
 	AddRoleActor desc(Descendant);
 	pTax->getRelativesInfo</*needCurrent=*/false, /*onlyDirect=*/false, /*upDirection=*/false> ( getTaxVertex(), desc );
 
-	// resize maps for fast access
-	DJRoles.resize(nRoles);
-	AncMap.resize(nRoles);
-	// init map for fast Anc/Desc access
-	addAncestorsToBitMap(AncMap);
+	// init row for fast Anc/Desc access
+	addAncestorsToRow(ancRow);
+	AncRow = ancRow;
 }
 
 void TRole :: postProcess ( void )
 {
 	// set Topmost-Functional field
 	initTopFunc();
-	// init DJ roles map
-	if ( isDisjoint() )
-		initDJMap();
 }
 
 /// check if the role is topmost-functional (internal-use only)
@@ -325,12 +320,13 @@ void TRole :: checkHierarchicalDisjoint ( TRole* R )
 		}
 }
 
-/// init map of all disjoint roles (N is a size of a bitmap)
-void TRole :: initDJMap ( void )
+/// init ROW of all disjoint roles
+void TRole :: initDJMap ( TRoleMatrix::Word* row )
 {
 	// role R is disjoint with every role S' [= S such that R != S
 	for ( const TRole* role : Disjoint )
-		DJRoles[role->getIndex()] = true;
+		TRoleMatrix::set ( row, role->getIndex() );
+	DJRow = row;
 }
 
 // automaton-related implementation
@@ -41,6 +41,38 @@ class RoleMaster;
 class Taxonomy;
 class SaveLoadManager;
 
+/// square bit-matrix over role indices; every row is a word-aligned bit-vector kept in one contiguous array
+class TRoleMatrix
+{
+public:		// types
+		/// type of a word of a row
+	typedef unsigned long Word;
+
+protected:	// members
+		/// all the rows of the matrix
+	std::vector<Word> Bits;
+		/// number of words in a row
+	size_t nWords = 0;
+
+		/// number of bits in a word
+	static constexpr unsigned int WordBits = 8*sizeof(Word);
+
+public:		// interface
+		/// make the matrix of NROLES x NROLES bits, all unset
+	void init ( size_t nRoles )
+	{
+		nWords = (nRoles+WordBits-1)/WordBits;
+		Bits.assign ( nRoles*nWords, 0 );
+	}
+		/// @return row with an index I
+	Word* row ( unsigned int i ) { return Bits.data() + i*nWords; }
+
+		/// set bit I in a ROW
+	static void set ( Word* row, unsigned int i ) { row[i/WordBits] |= Word(1) << (i%WordBits); }
+		/// @return true iff bit I is set in a ROW
+	static bool in ( const Word* row, unsigned int i ) { return (row[i/WordBits] >> (i%WordBits)) & 1; }
+}; // TRoleMatrix
+
 /// Define class with all information about DL role
 class TRole: public ClassifiableEntry
 {
@@ -73,8 +105,6 @@ public:		// types
 	typedef std::vector<TRole*> TRoleVec;
 		/// set of roles
 	typedef std::set<TRole*> TRoleSet;
-		/// bitmap for roles
-	typedef std::vector<bool> TRoleBitMap;
 
 protected:	// members
 		/// role that are inverse of given one
@@ -110,10 +140,10 @@ protected:	// members
 		/// all compositions in the form R1*R2*\ldots*Rn [= R
 	std::vector<TRoleVec> subCompositions;
 
-		/// bit-vector of all parents
-	TRoleBitMap AncMap;
-		/// bit-vector of all roles disjoint with current
-	TRoleBitMap DJRoles;
+		/// row of the RoleMaster's ancestor matrix: all parents and the role itself
+	const TRoleMatrix::Word* AncRow = nullptr;
+		/// row of the RoleMaster's disjointness matrix: all roles disjoint with current; NULL if there are none
+	const TRoleMatrix::Word* DJRow = nullptr;
 
 		/// automaton for role
 	RoleAutomaton A;
@@ -140,8 +170,8 @@ protected:	// methods
 	bool isRealTopFunc ( void ) const;
 		/// set up TopFunc member properly (internal-use only)
 	void initTopFunc ( void );
-		/// init map of all disjoint roles
-	void initDJMap ( void );
+		/// init ROW of all disjoint roles
+	void initDJMap ( TRoleMatrix::Word* row );
 
 		/// eliminate told role cycle, carrying aux arrays of processed roles and synonyms
 	TRole* eliminateToldCycles ( TRoleSet& RInProcess, TRoleVec& ToldSynonyms );
@@ -409,14 +439,14 @@ public:		// interface
 		/// check whether a role is disjoint with anything
 	bool isDisjoint ( void ) const { return !Disjoint.empty(); }
 		/// check whether a role is disjoint with R
-	bool isDisjoint ( const TRole* r ) const { return DJRoles[r->getIndex()]; }
+	bool isDisjoint ( const TRole* r ) const { return DJRow != nullptr && TRoleMatrix::in ( DJRow, r->getIndex() ); }
 
 	// role relations checking
 
 		/// two roles are the same iff thy are synonyms of the same role
 	bool operator == ( const TRole& r ) const { return this == &r; }
 		/// check if role is a strict sub-role of R
-	bool operator < ( const TRole& r ) const { return (isDataRole() == r.isDataRole()) && AncMap[r.getIndex()]; }
+	bool operator < ( const TRole& r ) const { return (this != &r) && (isDataRole() == r.isDataRole()) && TRoleMatrix::in ( AncRow, r.getIndex() ); }
 		/// check if role is a non-strict sub-role of R
 	bool operator <= ( const TRole& r ) const { return (*this == r) || (*this < r); }
 		/// check if role is a strict super-role of R
@@ -424,12 +454,12 @@ public:		// interface
 		/// check if role is a non-strict super-role of R
 	bool operator >= ( const TRole& r ) const { return (*this == r) || (*this > r); }
 
-		/// fills BITMAP with the role's ancestors
-	void addAncestorsToBitMap ( TRoleBitMap& bitmap ) const
+		/// fills ROW with the role's ancestors and the role itself
+	void addAncestorsToRow ( TRoleMatrix::Word* row ) const
 	{
-		fpp_assert ( !bitmap.empty() );	// use only after the size is known
+		TRoleMatrix::set ( row, getIndex() );
 		for ( const auto& sup: ancestors() )
-			bitmap[sup->getIndex()] = true;
+			TRoleMatrix::set ( row, sup->getIndex() );
 	}
 
 	// automaton construction
@@ -454,7 +484,7 @@ public:		// interface
 		return eliminateToldCycles ( RInProcess, ToldSynonyms );
 	}
 		/// init ancestors and descendants using Taxonomy
-	void initADbyTaxonomy ( Taxonomy* pTax, size_t ADMapSize );
+	void initADbyTaxonomy ( Taxonomy* pTax, TRoleMatrix::Word* ancRow );
 		/// init other fields that requires Anc/Desc for all roles
 	void postProcess ( void );
 		/// fills role composition by given TREE
@@ -541,6 +571,6 @@ inline TRole :: ~TRole()
 
 /// check whether one of the transitions accept R
 inline bool
-RAStateTransitions :: recognise ( const TRole* R ) const { return R != nullptr && R->isDataRole() == DataRole && ApplicableRoles.in(R->getIndex()); }
+RAStateTransitions :: recognise ( const TRole* R ) const { return R != nullptr && R->isDataRole() == DataRole && RoleStart[R->getIndex()] != RoleStart[R->getIndex()+1]; }
 
 #endif
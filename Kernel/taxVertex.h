@@ -64,6 +64,8 @@ protected:	// members
 	TLabeller::LabelType theValued;
 		/// number of common parents of a node
 	unsigned int common = 0;
+		/// position of a vertex in the taxonomy index (if any)
+	unsigned int indexPos = 0;
 		/// satisfiability value of a valued vertex
 	bool checkValue = false;
 		/// flag to check whether the vertex is in use
@@ -117,6 +119,10 @@ public:		// flags interface
 		clearCommon();
 	}
 
+	// index part
+	unsigned int getIndexPos ( void ) const { return indexPos; }
+	void setIndexPos ( unsigned int pos ) { indexPos = pos; }
+
 	// get info about taxonomy structure
 
 	const EqualNames& synonyms ( void ) const { return Synonyms; }